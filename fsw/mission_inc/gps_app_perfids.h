@@ -25,6 +25,10 @@
 #ifndef GPS_APP_PERFIDS_H
 #define GPS_APP_PERFIDS_H
 
-#define GPS_APP_PERF_ID 91
+#define GPS_APP_PERF_ID        91
+#define GPS_APP_GEO_PERF_ID    92
+#define GPS_APP_FENCE_PERF_ID  93
+#define GPS_APP_EST_PERF_ID    94
+#define GPS_APP_STREAM_PERF_ID 95
 
 #endif /* GPS_APP_PERFIDS_H */
@@ -32,8 +32,19 @@
 #define GPS_APP_SEND_HK_MID 0x18C1
 #define GPS_APP_SEND_RF_MID 0x18C2
 #define GPS_APP_READ_MID 	 0x18C3
+#define GPS_APP_CYCLE_MID   0x18C4
+#define GPS_APP_EST_TICK_MID 0x18C5
+#define GPS_APP_SEND_SV_MID 0x18C6
 /* V1 Telemetry Message IDs must be 0x08xx */
 #define GPS_APP_HK_TLM_MID 0x08C1
 #define GPS_APP_RF_DATA_MID 0x08C2
+#define GPS_APP_GEO_TLM_MID 0x08C3
+#define GPS_APP_DIAG_TLM_MID 0x08C4
+#define GPS_APP_STATS_TLM_MID 0x08C5
+#define GPS_APP_EST_TLM_MID 0x08C6
+#define GPS_APP_SV_TLM_MID 0x08C7
+#define GPS_APP_BURST_TLM_MID 0x08C8
+#define GPS_APP_STREAM_FAST_MID 0x08C9 /* Default output streams, see the stream table */
+#define GPS_APP_STREAM_SLOW_MID 0x08CA
 
 #endif /* GPS_APP_MSGIDS_H */
@@ -0,0 +1,185 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Define GPS App platform configuration parameters
+ */
+
+#ifndef GPS_APP_PLATFORM_CFG_H
+#define GPS_APP_PLATFORM_CFG_H
+
+/*
+** Load generator child task
+*/
+#define GPS_APP_LOADGEN_TASK_NAME       "GPS_LOADGEN"
+#define GPS_APP_LOADGEN_STACK_SIZE      8192
+#define GPS_APP_LOADGEN_PRIORITY        60  /* Above the app so it can outrun the pipe */
+#define GPS_APP_LOADGEN_MAX_STEPS       32  /* Results kept for the overload curve */
+#define GPS_APP_LOADGEN_DRAIN_MS        200 /* Settle time after each step before sampling counters */
+
+/*
+** Geodetic conversion self test
+*/
+#define GPS_APP_GEO_BENCH_COUNT      256   /* Fixes per kernel call */
+#define GPS_APP_GEO_BENCH_LOOPS      16    /* Kernel calls timed */
+#define GPS_APP_GEO_SELFTEST_TOL_M   0.005 /* Worst allowed error, meters, up to 700 km altitude */
+
+/*
+** Geofence
+*/
+#define GPS_APP_FENCE_TBL_NAME         "FenceTbl"
+#define GPS_APP_FENCE_TBL_FILE         "/cf/gps_app_fence_tbl.tbl"
+#define GPS_APP_FENCE_MAX_REGIONS      32    /* At most 32, regions are tracked in bit masks */
+#define GPS_APP_FENCE_MAX_VERTICES     16
+#define GPS_APP_FENCE_CELL_DEG         0.01  /* Grid cell size, about 1.1 km of latitude */
+#define GPS_APP_FENCE_GRID_BUCKETS     1024  /* Hashed grid size, must be a power of two */
+#define GPS_APP_FENCE_MAX_REGION_CELLS 4096  /* Larger regions are tested on every fix */
+#define GPS_APP_FENCE_MAX_RADIUS_M     1.0e6 /* Largest circle a table may hold */
+
+/*
+** Warm start
+*/
+#define GPS_APP_CDS_NAME              "LastFix"
+#define GPS_APP_AIDING_ENABLED        0       /* 1 if the uC forwards writes to the receiver's UBX port */
+#define GPS_APP_AID_POS_ACC_CM        10000   /* Position accuracy claimed for a restored fix */
+#define GPS_APP_AID_TIME_ACC_MS       2000    /* Time accuracy claimed after a reset */
+#define GPS_APP_AID_MAX_AGE_S         600     /* Older fixes are not sent, the vehicle may have moved */
+#define GPS_APP_CFE_TO_GPS_EPOCH_SECS (-432019) /* cFE TAI epoch 1980-001 to GPS epoch 1980-006, less TAI-GPS */
+
+/*
+** Pipelined read/publish cycle
+*/
+#define GPS_APP_READER_TASK_NAME       "GPS_READER"
+#define GPS_APP_READER_STACK_SIZE      8192
+#define GPS_APP_READER_PRIORITY        70  /* Just above the app, the transfer gates the next publish */
+#define GPS_APP_CYCLE_SEM_NAME         "GPS_CYC_SEM"
+#define GPS_APP_CYCLE_MUTEX_NAME       "GPS_CYC_MUT"
+#define GPS_APP_CYCLE_DEFAULT_PHASE_MS 0
+#define GPS_APP_CYCLE_MAX_PHASE_MS     1000
+
+/*
+** Read paths
+*/
+#define GPS_APP_READ_BENCH_MAX    1000 /* Fixes per path in one benchmark command */
+#define GPS_APP_DEV_MUTEX_NAME    "GPS_DEV_MUT"
+#define GPS_APP_BENCH_TASK_NAME   "GPS_BENCH"
+#define GPS_APP_BENCH_STACK_SIZE  8192
+#define GPS_APP_BENCH_PRIORITY    150 /* Below the app, the pipe is serviced while the benchmark runs */
+#define GPS_APP_BENCH_SEM_NAME    "GPS_BENCH_SEM"
+
+/*
+** Fix log
+*/
+#define GPS_APP_LOG_DIR             "/ram"
+#define GPS_APP_LOG_BLOCK_SIZE      4096 /* Bytes per write, match the file system block size */
+#define GPS_APP_LOG_BLOCKS_PER_FILE 256  /* 1 MB files */
+#define GPS_APP_LOG_MAX_FILES       8    /* Files in the ring, the oldest is overwritten */
+#define GPS_APP_LOG_QUEUE_DEPTH     256  /* Fixes buffered for the writer, must be a power of two */
+#define GPS_APP_LOG_POLL_MS         100
+#define GPS_APP_LOG_TASK_NAME       "GPS_LOGGER"
+#define GPS_APP_LOG_STACK_SIZE      8192
+#define GPS_APP_LOG_PRIORITY        200 /* Below the app, file I/O must not delay the fix path */
+#define GPS_APP_LOG_MUTEX_NAME      "GPS_LOG_MUT"
+#define GPS_APP_LOG_SEM_NAME        "GPS_LOG_SEM"
+#define GPS_APP_LOG_CLOSE_MS        1000 /* Wait for the writer to flush at app exit */
+
+/*
+** Position statistics
+*/
+#define GPS_APP_STATS_WINDOW 64 /* Fixes in the sliding window */
+
+/*
+** Position/velocity estimator
+*/
+#define GPS_APP_EST_ACCEL_PSD      1.0     /* Acceleration noise, m^2/s^3 */
+#define GPS_APP_EST_HORIZ_SIGMA_M  3.0     /* Fix noise, East and North */
+#define GPS_APP_EST_VERT_SIGMA_M   6.0     /* Fix noise, Up */
+#define GPS_APP_EST_INIT_VEL_SIGMA 10.0    /* Velocity uncertainty at a restart, m/s */
+#define GPS_APP_EST_MAX_GAP_MS     10000   /* Fix gap that restarts the filter */
+#define GPS_APP_EST_REORIGIN_M     10000.0 /* Horizontal distance that moves the local frame */
+
+/*
+** Velocity stage
+*/
+#define GPS_APP_VEL_TAU_S              2.0   /* Smoothing time constant */
+#define GPS_APP_VEL_MAX_GAP_MS         5000  /* Fix gap that restarts the differencing */
+#define GPS_APP_VEL_MIN_COURSE_SPEED   0.5   /* m/s, below it the course is held */
+
+/*
+** Satellite table
+*/
+#define GPS_APP_SV_CNO_DEADBAND    2  /* dBHz of C/N0 change before an SV is sent again */
+#define GPS_APP_SV_KEYFRAME_PERIOD 10 /* Every Nth packet carries the whole table */
+#define GPS_APP_SV_RX_MAX_CH       72 /* Most channels the receiver reports in NAV-SVINFO, sizes the buffer */
+
+/*
+** Burst capture
+*/
+#define GPS_APP_BURST_RING_SIZE       4096   /* Fixes held for one burst */
+#define GPS_APP_BURST_MAX_DURATION_MS 600000
+#define GPS_APP_BURST_MAX_PKT_RATE    20     /* Drain packets per second */
+#define GPS_APP_BURST_TASK_NAME       "GPS_BURST"
+#define GPS_APP_BURST_STACK_SIZE      8192
+#define GPS_APP_BURST_PRIORITY        90  /* Below the app, a back-to-back capture must not starve commands */
+#define GPS_APP_BURST_SEM_NAME        "GPS_BURST_SEM"
+
+/*
+** Handler deadlines, per subscribed MID
+*/
+#define GPS_APP_DEADLINE_CMD_US     5000
+#define GPS_APP_DEADLINE_SEND_HK_US 5000
+#define GPS_APP_DEADLINE_SEND_RF_US 2000
+#define GPS_APP_DEADLINE_READ_US    5000  /* One bus transfer and the per-fix stages */
+#define GPS_APP_DEADLINE_CYCLE_US   5000
+#define GPS_APP_DEADLINE_EST_US     1000  /* Ticks run at the control loop rate */
+#define GPS_APP_DEADLINE_SV_US      10000 /* Reads the NAV-SVINFO header, then the frame */
+#define GPS_APP_DEADLINE_WINDOW_MS  10000 /* One overrun event per window */
+
+/*
+** Fix validation
+*/
+#define GPS_APP_VALID_MIN_ALT_M       -1000.0  /* Meters above the ellipsoid */
+#define GPS_APP_VALID_MAX_ALT_M       50000.0
+#define GPS_APP_VALID_MIN_SATELLITES  4        /* Fewer cannot give a 3D fix */
+#define GPS_APP_VALID_MAX_SPEED       500.0    /* m/s, fastest the vehicle can move */
+#define GPS_APP_VALID_JUMP_MARGIN_M   100.0    /* Allowed on top of that for fix noise */
+#define GPS_APP_VALID_JUMP_RESYNC     5        /* Jump rejects in a row before re-anchoring */
+
+/*
+** Output streams
+*/
+#define GPS_APP_STREAM_TBL_NAME "StreamTbl"
+#define GPS_APP_STREAM_TBL_FILE "/cf/gps_app_stream_tbl.tbl"
+
+/*
+** Adaptive poll rate
+*/
+#define GPS_APP_POLL_WAKEUP_HZ       10   /* Scheduled rate of GPS_APP_READ_MID */
+#define GPS_APP_POLL_IDLE_DIVISOR    10   /* Wakeups per read when idle, 1 disables the adaptation */
+#define GPS_APP_POLL_RAISE_SPEED     2.0  /* m/s */
+#define GPS_APP_POLL_RAISE_ACCEL     0.5  /* m/s^2 */
+#define GPS_APP_POLL_RAISE_MOVE_RATE 5.0  /* m/s, distance between fixes over the time between them */
+#define GPS_APP_POLL_DECAY_SPEED     1.0  /* Decay thresholds, below the raise ones for hysteresis */
+#define GPS_APP_POLL_DECAY_ACCEL     0.2
+#define GPS_APP_POLL_DECAY_MOVE_RATE 2.0
+#define GPS_APP_POLL_HOLD_MS         5000 /* Time under the decay thresholds before going idle */
+#define GPS_APP_POLL_SET_NAV_RATE    0    /* 1 to send UBX CFG-RATE to the receiver on each switch */
+
+#endif /* GPS_APP_PLATFORM_CFG_H */
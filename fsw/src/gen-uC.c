@@ -11,6 +11,119 @@
 static const char bus_path[] = "/dev/i2c-2";
 
 static int uC_ioctl(i2c_dev *dev, ioctl_command_t command, void *arg);
+static ssize_t uC_read(i2c_dev *dev, void *buf, size_t n, off_t offset);
+
+static uint32_t uC_sim_latency_us = UC_SIM_DEFAULT_LATENCY_US;
+static uC_error_stats uC_errors;
+
+static void uC_record_error(uC_error_kind kind, int err){
+  __atomic_fetch_add(&uC_errors.count[kind], 1, __ATOMIC_RELAXED);
+  __atomic_store_n(&uC_errors.last_kind, (uint32_t) kind, __ATOMIC_RELAXED);
+  __atomic_store_n(&uC_errors.last_errno, err, __ATOMIC_RELAXED);
+}
+
+void uC_get_error_stats(uC_error_stats *stats){
+  int k;
+
+  for (k = 0; k < UC_ERR_KINDS; ++k) {
+    stats->count[k] = __atomic_load_n(&uC_errors.count[k], __ATOMIC_RELAXED);
+  }
+  stats->last_kind = __atomic_load_n(&uC_errors.last_kind, __ATOMIC_RELAXED);
+  stats->last_errno = __atomic_load_n(&uC_errors.last_errno, __ATOMIC_RELAXED);
+}
+
+void uC_sim_set_latency(uint32_t usec){
+  uC_sim_latency_us = usec;
+}
+
+#ifdef UC_SIM_BUS
+#include <time.h>
+
+/*
+ * Synthetic NAV-SVINFO frame: eight SVs whose C/N0 drifts a little on every
+ * read, so consumers see a changing table.
+ */
+static void uC_sim_svinfo(uint8_t *buf, uint16_t len){
+  static uint32_t reads;
+  uint8_t frame[6 + 8 + 8 * 12 + 2];
+  uint8_t *sv;
+  uint8_t ck_a = 0;
+  uint8_t ck_b = 0;
+  uint32_t i;
+
+  memset(frame, 0, sizeof(frame));
+  frame[0] = 0xB5;
+  frame[1] = 0x62;
+  frame[2] = 0x01;
+  frame[3] = 0x30;
+  frame[4] = 8 + 8 * 12;
+  frame[10] = 8;
+
+  for (i = 0; i < 8; ++i) {
+    sv = &frame[6 + 8 + 12 * i];
+    sv[0] = i;
+    sv[1] = 2 + 3 * i;
+    sv[2] = (i < 6) ? 0x01 : 0x00;
+    sv[3] = 7;
+    sv[4] = 30 + 2 * i + ((reads + i) % 5);
+    sv[5] = 10 + 9 * i;
+    sv[6] = (uint8_t)((45 * i) & 0xFF);
+    sv[7] = (uint8_t)((45 * i) >> 8);
+  }
+  ++reads;
+
+  for (i = 2; i < sizeof(frame) - 2; ++i) {
+    ck_a += frame[i];
+    ck_b += ck_a;
+  }
+  frame[sizeof(frame) - 2] = ck_a;
+  frame[sizeof(frame) - 1] = ck_b;
+
+  memset(buf, 0, len);
+  memcpy(buf, frame, len < sizeof(frame) ? len : sizeof(frame));
+}
+
+/*
+ * Stand-in for the I2C_RDWR ioctl: blocks the caller for the configured
+ * latency like a synchronous transfer would and answers reads with a fixed
+ * fix (lat, lon, alt as floats, then satellites), or a synthetic NAV-SVINFO
+ * frame if the register written first was UC_SVINFO_REGISTER.
+ */
+static int uC_sim_transfer(struct i2c_rdwr_ioctl_data *payload){
+  static const float fix[3] = {18.2101f, -67.1411f, 25.0f};
+  struct timespec delay = {
+    .tv_sec = uC_sim_latency_us / 1000000,
+    .tv_nsec = (long)(uC_sim_latency_us % 1000000) * 1000,
+  };
+  uint8_t reg = UC_FIX_REGISTER;
+  uint32_t m;
+
+  nanosleep(&delay, NULL);
+
+  for (m = 0; m < payload->nmsgs; ++m) {
+    i2c_msg *msg = &payload->msgs[m];
+    if (!(msg->flags & I2C_M_RD)) {
+      if (msg->len > 0) {
+        reg = msg->buf[0];
+      }
+    } else if (reg == UC_SVINFO_REGISTER) {
+      uC_sim_svinfo(msg->buf, msg->len);
+    } else {
+      memset(msg->buf, 0, msg->len);
+      memcpy(msg->buf, fix, msg->len < sizeof(fix) ? msg->len : sizeof(fix));
+      if (msg->len > sizeof(fix)) {
+        msg->buf[sizeof(fix)] = 8;
+      }
+    }
+  }
+
+  return 0;
+}
+
+#define uC_transfer(fd, payload) uC_sim_transfer(payload)
+#else
+#define uC_transfer(fd, payload) ioctl(fd, I2C_RDWR, payload)
+#endif
 
 int uC_set_bytes(uint16_t chip_address, uint8_t **val, int numBytes){
 
@@ -40,13 +153,13 @@ int uC_set_bytes(uint16_t chip_address, uint8_t **val, int numBytes){
 
   fd = open(&bus_path[0], O_RDWR);
   if (fd < 0) {
-    printf("Couldn't open bus...\n");
+    uC_record_error(UC_ERR_OPEN, errno);
     return 1;
   }
 
-  rv = ioctl(fd, I2C_RDWR, &payload);
+  rv = uC_transfer(fd, &payload);
   if (rv < 0) {
-    perror("ioctl failed");
+    uC_record_error(UC_ERR_TRANSFER, errno);
   }
   close(fd);
 
@@ -56,11 +169,11 @@ int uC_set_bytes(uint16_t chip_address, uint8_t **val, int numBytes){
 int uC_read_bytes(uint16_t nr_bytes, uint8_t **buff){
   int fd;
   uint16_t i2c_address = (uint16_t) UC_ADDRESS;
-  uint8_t data_address = (uint8_t) 0;
+  uint8_t data_address = (uint8_t) UC_FIX_REGISTER;
 
   fd = open(&bus_path[0], O_RDWR);
   if (fd < 0) {
-    printf("Couldn't open bus...\n");
+    uC_record_error(UC_ERR_OPEN, errno);
     return 1;
   }
 
@@ -83,18 +196,60 @@ int uC_read_bytes(uint16_t nr_bytes, uint8_t **buff){
   };
   uint16_t i;
 
-  rv = ioctl(fd, I2C_RDWR, &payload);
+  rv = uC_transfer(fd, &payload);
   if (rv < 0) {
-    printf("ioctl failed...\n");
+    uC_record_error(UC_ERR_TRANSFER, errno);
   } else {
 
     free(*buff);
     *buff = malloc(nr_bytes * sizeof(uint8_t));
 
-    for (i = 0; i < nr_bytes; ++i) {
-      (*buff)[i] = value[i];
+    if (*buff == NULL) {
+      uC_record_error(UC_ERR_ALLOC, ENOMEM);
+      rv = -1;
+    } else {
+      for (i = 0; i < nr_bytes; ++i) {
+        (*buff)[i] = value[i];
+      }
     }
   }
+  close(fd);
+
+  return rv;
+}
+
+// Read nr_bytes from a uC register into a caller buffer, no allocation
+int uC_read_reg(uint8_t reg, uint8_t *buf, uint16_t nr_bytes){
+  int fd;
+  int rv;
+  uint16_t i2c_address = (uint16_t) UC_ADDRESS;
+  i2c_msg msgs[] = {{
+    .addr = i2c_address,
+    .flags = 0,
+    .buf = &reg,
+    .len = 1,
+  }, {
+    .addr = i2c_address,
+    .flags = I2C_M_RD,
+    .buf = buf,
+    .len = nr_bytes,
+  }};
+  struct i2c_rdwr_ioctl_data payload = {
+    .msgs = msgs,
+    .nmsgs = sizeof(msgs)/sizeof(msgs[0]),
+  };
+
+  fd = open(&bus_path[0], O_RDWR);
+  if (fd < 0) {
+    uC_record_error(UC_ERR_OPEN, errno);
+    return 1;
+  }
+
+  rv = uC_transfer(fd, &payload);
+  if (rv < 0) {
+    uC_record_error(UC_ERR_TRANSFER, errno);
+  }
+  close(fd);
 
   return rv;
 }
@@ -102,12 +257,13 @@ int uC_read_bytes(uint16_t nr_bytes, uint8_t **buff){
 int i2c_dev_register_uC(const char *bus_path, const char *dev_path){
   i2c_dev *dev;
 
-  dev = i2c_dev_alloc_and_init(sizeof(*dev), bus_path, UC_ADDRESS);
+  dev = i2c_dev_alloc_and_init(sizeof(uC_dev), bus_path, UC_ADDRESS);
   if (dev == NULL) {
     return -1;
   }
 
   dev->ioctl = uC_ioctl;
+  dev->read = uC_read;
 
   return i2c_dev_register(dev, dev_path);
 }
@@ -124,12 +280,18 @@ static int uC_ioctl(i2c_dev *dev, ioctl_command_t command, void *arg){
 
       val = NULL;
       val = malloc(numBytes * sizeof(uint8_t));
+      if (val == NULL) {
+        uC_record_error(UC_ERR_ALLOC, ENOMEM);
+        err = -ENOMEM;
+        break;
+      }
 
       val[0] = 0x03;
       val[1] = 0x06;
       val[2] = 0x09;
 
       err = uC_set_bytes(UC_ADDRESS, &val, numBytes); //Send 0x03, 0x06 and 0x09 to the uC default address
+      free(val);
       break;
 
     default:
@@ -140,6 +302,50 @@ static int uC_ioctl(i2c_dev *dev, ioctl_command_t command, void *arg){
   return err;
 }
 
+static ssize_t uC_read(i2c_dev *dev, void *buf, size_t n, off_t offset){
+  uC_dev *uc = (uC_dev *) dev;
+  uint8_t data_address = (uint8_t) UC_FIX_REGISTER;
+  i2c_msg msgs[] = {{
+    .addr = dev->address,
+    .flags = 0,
+    .buf = &data_address,
+    .len = 1,
+  }, {
+    .addr = dev->address,
+    .flags = I2C_M_RD,
+    .buf = uc->buf,
+    .len = UC_FIX_BYTES,
+  }};
+  int err;
+
+  if (n > UC_FIX_BYTES) {
+    n = UC_FIX_BYTES;
+  }
+
+  // Hold the bus across the transfer and the copy so concurrent readers
+  // can't overwrite the driver buffer in between
+  i2c_bus_obtain(dev->bus);
+#ifdef UC_SIM_BUS
+  struct i2c_rdwr_ioctl_data payload = {
+    .msgs = msgs,
+    .nmsgs = sizeof(msgs)/sizeof(msgs[0]),
+  };
+  err = uC_sim_transfer(&payload);
+#else
+  err = i2c_bus_transfer(dev->bus, msgs, sizeof(msgs)/sizeof(msgs[0]));
+#endif
+  if (err == 0) {
+    memcpy(buf, uc->buf, n);
+  }
+  i2c_bus_release(dev->bus);
+
+  if (err != 0) {
+    uC_record_error(UC_ERR_TRANSFER, -err);
+  }
+
+  return (err == 0) ? (ssize_t) n : (ssize_t) err;
+}
+
 int uC_send_test(int fd){
   return ioctl(fd, UC_SEND_TEST, NULL);
 }
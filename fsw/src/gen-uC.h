@@ -27,6 +27,16 @@ extern "C" {
 // Device address
 #define UC_ADDRESS 0x36
 
+// Size of one fix (lat, lon, alt as floats, satellites, status) at register 0
+#define UC_FIX_REGISTER 0
+#define UC_FIX_BYTES 14
+
+// Last UBX NAV-SVINFO frame from the receiver, zero padded, at register 1
+#define UC_SVINFO_REGISTER 1
+
+// Default transfer latency of the simulated bus (UC_SIM_BUS builds only)
+#define UC_SIM_DEFAULT_LATENCY_US 1000
+
 /**
  * @defgroup I2CMicroController Driver
  *
@@ -41,6 +51,32 @@ typedef enum {
   UC_SEND_TEST
 } uC_command;
 
+/*
+ * Driver failures are counted, not printed: a console write from the
+ * acquisition path blocks for milliseconds exactly when the bus is failing.
+ */
+typedef enum {
+  UC_ERR_OPEN,
+  UC_ERR_TRANSFER,
+  UC_ERR_ALLOC,
+  UC_ERR_KINDS
+} uC_error_kind;
+
+typedef struct {
+  uint32_t count[UC_ERR_KINDS];
+  uint32_t last_kind;
+  int last_errno;
+} uC_error_stats;
+
+/*
+ * Registered device. A read() on it fetches a fresh fix into buf, inside the
+ * bus lock, and copies it out; reads are not positional.
+ */
+typedef struct {
+  i2c_dev base;
+  uint8_t buf[UC_FIX_BYTES];
+} uC_dev;
+
 int i2c_dev_register_uC(const char *bus_path, const char *dev_path);
 int uC_send_test(int fd);
 
@@ -49,6 +85,15 @@ int uC_send_test(int fd);
 
 int uC_set_bytes(uint16_t chip_address, uint8_t **val, int numBytes);
 int uC_read_bytes(uint16_t nr_bytes, uint8_t **buff);
+int uC_read_reg(uint8_t reg, uint8_t *buf, uint16_t nr_bytes);
+
+// Simulated bus, only takes effect when built with UC_SIM_BUS
+
+void uC_sim_set_latency(uint32_t usec);
+
+// Error counters, safe to read from any task
+
+void uC_get_error_stats(uC_error_stats *stats);
 
 
 /** @} */
@@ -94,6 +94,9 @@ void GPS_APP_Main(void)
     */
     CFE_ES_PerfLogExit(GPS_APP_PERF_ID);
 
+    GPS_APP_Log_Close();
+    GPS_APP_Dev_Close();
+
     CFE_ES_ExitApp(GPS_APP_Data.RunStatus);
 }
 
@@ -119,6 +122,8 @@ int32 GPS_APP_Init(void)
     GPS_APP_Data.altitude = 0;
     GPS_APP_Data.satellites = 0;
 
+    GPS_APP_Load_Init();
+
     /*
     ** Initialize app configuration data
     */
@@ -127,10 +132,22 @@ int32 GPS_APP_Init(void)
     strncpy(GPS_APP_Data.PipeName, "GPS_APP_CMD_PIPE", sizeof(GPS_APP_Data.PipeName));
     GPS_APP_Data.PipeName[sizeof(GPS_APP_Data.PipeName) - 1] = 0;
 
+    /*
+    ** Initialize event filter table. Events that can repeat on every fix
+    ** or every packet are cut off after the first few; a reset counters
+    ** command re-arms them.
+    */
+    GPS_APP_Data.EventFilters[0].EventID = GPS_APP_DRIVER_ERR_EID;
+    GPS_APP_Data.EventFilters[0].Mask    = CFE_EVS_FIRST_16_STOP;
+    GPS_APP_Data.EventFilters[1].EventID = GPS_APP_INVALID_MSGID_ERR_EID;
+    GPS_APP_Data.EventFilters[1].Mask    = CFE_EVS_FIRST_8_STOP;
+    GPS_APP_Data.EventFilters[2].EventID = GPS_APP_LEN_ERR_EID;
+    GPS_APP_Data.EventFilters[2].Mask    = CFE_EVS_FIRST_8_STOP;
+
     /*
     ** Register the events
     */
-    status = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
+    status = CFE_EVS_Register(GPS_APP_Data.EventFilters, GPS_APP_EVENT_COUNTS, CFE_EVS_EventFilter_BINARY);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("GPS App: Error Registering Events, RC = 0x%08lX\n", (unsigned long)status);
@@ -150,6 +167,12 @@ int32 GPS_APP_Init(void)
                 sizeof(GPS_APP_Data.OutData));
    GPS_APP_Data.OutData.App_Pckg_Counter = 0;
 
+    /*
+    ** Initialize geodetic telemetry packet.
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_Data.GeoTlm.TelemetryHeader), CFE_SB_ValueToMsgId(GPS_APP_GEO_TLM_MID),
+                 sizeof(GPS_APP_Data.GeoTlm));
+
     /*
     ** Create Software Bus message pipe.
     */
@@ -191,6 +214,39 @@ int32 GPS_APP_Init(void)
         return status;
     }
 
+    /*
+    ** Subscribe to pipelined cycle wakeups
+    */
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(GPS_APP_CYCLE_MID), GPS_APP_Data.CommandPipe);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error Subscribing to cycle wakeup, RC = 0x%08lX\n", (unsigned long)status);
+
+        return status;
+    }
+
+    /*
+    ** Subscribe to estimator ticks
+    */
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(GPS_APP_EST_TICK_MID), GPS_APP_Data.CommandPipe);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error Subscribing to estimator tick, RC = 0x%08lX\n", (unsigned long)status);
+
+        return status;
+    }
+
+    /*
+    ** Subscribe to satellite table requests
+    */
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(GPS_APP_SEND_SV_MID), GPS_APP_Data.CommandPipe);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error Subscribing to satellite request, RC = 0x%08lX\n", (unsigned long)status);
+
+        return status;
+    }
+
     /*
     ** Subscribe to ground command packets
     */
@@ -202,6 +258,82 @@ int32 GPS_APP_Init(void)
         return status;
     }
 
+    /*
+    ** Register and load the geofence table
+    */
+    status = GPS_APP_Fence_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    /*
+    ** Register and load the output stream table
+    */
+    status = GPS_APP_Stream_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    /*
+    ** Initialize fix validation, the poll rate and the diagnostics,
+    ** statistics, estimator and satellite packets
+    */
+    GPS_APP_Valid_Init();
+    GPS_APP_Poll_Init();
+    GPS_APP_Diag_Init();
+    GPS_APP_Stats_Init();
+    GPS_APP_Est_Init();
+    GPS_APP_Vel_Init();
+    GPS_APP_Sv_Init();
+
+    /*
+    ** Open the genuC device for the fast read path
+    */
+    status = GPS_APP_Dev_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    /*
+    ** Restore the last fix after a processor reset
+    */
+    status = GPS_APP_Cds_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+    GPS_APP_UpdateGeo();
+
+    /*
+    ** Start the reader task for the pipelined cycle
+    */
+    status = GPS_APP_Cycle_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    /*
+    ** Start the fix log writer
+    */
+    status = GPS_APP_Log_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    /*
+    ** Start the burst capture task, idle until armed
+    */
+    status = GPS_APP_Burst_Init();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
     CFE_EVS_SendEvent(GPS_APP_STARTUP_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS App Initialized.%s",
                       GPS_APP_VERSION_STRING);
 
@@ -218,7 +350,9 @@ int32 GPS_APP_Init(void)
 void GPS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
 {
     CFE_SB_MsgId_t MsgId = CFE_SB_INVALID_MSG_ID;
+    OS_time_t      StartTime;
 
+    CFE_PSP_GetTime(&StartTime);
     CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
 
     switch (CFE_SB_MsgIdToValue(MsgId))
@@ -232,11 +366,29 @@ void GPS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
             break;
 
         case GPS_APP_SEND_RF_MID:
-            GPS_APP_ReportRFTelemetry((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            if (!GPS_APP_Cycle_Skip())
+            {
+                GPS_APP_ReportRFTelemetry((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            }
             break;
 
         case GPS_APP_READ_MID:
-            GPS_APP_ReadSensor((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            if (!GPS_APP_Cycle_Skip())
+            {
+                GPS_APP_ReadSensor((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            }
+            break;
+
+        case GPS_APP_CYCLE_MID:
+            GPS_APP_Cycle_Run((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            break;
+
+        case GPS_APP_EST_TICK_MID:
+            GPS_APP_Est_Tick((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            break;
+
+        case GPS_APP_SEND_SV_MID:
+            GPS_APP_Sv_Send((CFE_MSG_CommandHeader_t *)SBBufPtr);
             break;
 
         default:
@@ -244,6 +396,8 @@ void GPS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
                               "GPS: invalid command packet,MID = 0x%x", (unsigned int)CFE_SB_MsgIdToValue(MsgId));
             break;
     }
+
+    GPS_APP_Load_RecordDispatch(SBBufPtr, MsgId, StartTime);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
@@ -278,6 +432,102 @@ void GPS_APP_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
 
             break;
 
+        case GPS_APP_LOADGEN_START_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_LoadGenStartCmd_t)))
+            {
+                GPS_APP_LoadGenStart((GPS_APP_LoadGenStartCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_LOADGEN_STOP_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_LoadGenStopCmd_t)))
+            {
+                GPS_APP_LoadGenStop((GPS_APP_LoadGenStopCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_SET_ENU_REF_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_SetEnuRefCmd_t)))
+            {
+                GPS_APP_SetEnuRef((GPS_APP_SetEnuRefCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_GEO_SELFTEST_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_GeoSelfTestCmd_t)))
+            {
+                GPS_APP_GeoSelfTest((GPS_APP_GeoSelfTestCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_SET_CYCLE_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_SetCycleCmd_t)))
+            {
+                GPS_APP_SetCycle((GPS_APP_SetCycleCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_SET_READ_PATH_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_SetReadPathCmd_t)))
+            {
+                GPS_APP_SetReadPath((GPS_APP_SetReadPathCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_READ_BENCH_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_ReadBenchCmd_t)))
+            {
+                GPS_APP_ReadBench((GPS_APP_ReadBenchCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_LOG_EXTRACT_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_LogExtractCmd_t)))
+            {
+                GPS_APP_LogExtract((GPS_APP_LogExtractCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_RESET_STATS_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_ResetStatsCmd_t)))
+            {
+                GPS_APP_ResetStats((GPS_APP_ResetStatsCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_BURST_ARM_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_BurstArmCmd_t)))
+            {
+                GPS_APP_BurstArm((GPS_APP_BurstArmCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_BURST_DRAIN_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_BurstDrainCmd_t)))
+            {
+                GPS_APP_BurstDrain((GPS_APP_BurstDrainCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case GPS_APP_SET_DEADLINE_CC:
+            if (GPS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(GPS_APP_SetDeadlineCmd_t)))
+            {
+                GPS_APP_SetDeadline((GPS_APP_SetDeadlineCmd_t *)SBBufPtr);
+            }
+
+            break;
+
         /* default case already found during FC vs length test */
         default:
             CFE_EVS_SendEvent(GPS_APP_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -286,11 +536,43 @@ void GPS_APP_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS read command: acquire a sample and commit it, on the wakeups the       */
+/* adaptive poll rate selects                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 int32 GPS_APP_ReadSensor(const CFE_MSG_CommandHeader_t *Msg){
-  uint8_t *tmp;
-  tmp = NULL;
+  GPS_APP_Sample_t Sample;
+  int32 status;
 
-  uC_read_bytes(14, &tmp);
+  if (!GPS_APP_Poll_Due()) {
+    return CFE_SUCCESS;
+  }
+
+  status = GPS_APP_AcquireSample(&Sample);
+
+  if (status == CFE_SUCCESS && GPS_APP_CommitSample(&Sample)) {
+    GPS_APP_Poll_Update(&Sample);
+  }
+
+  return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Read one fix from the uC and decode it. Runs in the main, reader and       */
+/* burst tasks; only touches the read path, whose statistics are locked.      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_AcquireSample(GPS_APP_Sample_t *Sample){
+  uint8_t tmp[GPS_APP_SAMPLE_BYTES];
+  int32 status;
+
+  status = GPS_APP_Dev_Fetch(GPS_APP_Data.Dev.Path, tmp, sizeof(tmp));
+  if (status != CFE_SUCCESS) {
+    return status;
+  }
 
   floatu_t lat_u;
   floatu_t long_u;
@@ -306,15 +588,41 @@ int32 GPS_APP_ReadSensor(const CFE_MSG_CommandHeader_t *Msg){
     }
   }
 
-  GPS_APP_Data.latitude = lat_u.number;
-  GPS_APP_Data.longitude = long_u.number;
-  GPS_APP_Data.altitude = alt_u.number;
-  GPS_APP_Data.satellites = tmp[12];
+  Sample->latitude = lat_u.number;
+  Sample->longitude = long_u.number;
+  Sample->altitude = alt_u.number;
+  Sample->satellites = tmp[12];
+  CFE_PSP_GetTime(&Sample->AcquiredTime);
 
-  free(tmp);
+  return CFE_SUCCESS;
+}
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Make a sample the current fix and run the per-fix stages on it. False if   */
+/* it failed validation and was dropped.                                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool GPS_APP_CommitSample(const GPS_APP_Sample_t *Sample){
+  if (!GPS_APP_Valid_Check(Sample)) {
+    return false;
+  }
 
-  return CFE_SUCCESS;
+  GPS_APP_Data.latitude = Sample->latitude;
+  GPS_APP_Data.longitude = Sample->longitude;
+  GPS_APP_Data.altitude = Sample->altitude;
+  GPS_APP_Data.satellites = Sample->satellites;
+
+  GPS_APP_UpdateGeo();
+  GPS_APP_Fence_Evaluate(GPS_APP_Data.latitude, GPS_APP_Data.longitude);
+  GPS_APP_Cds_RecordFix();
+  GPS_APP_Stats_Update(Sample);
+  GPS_APP_Est_Update(Sample);
+  GPS_APP_Vel_Update(Sample);
+  GPS_APP_Log_Push(Sample);
+  GPS_APP_Stream_Run();
+
+  return true;
 }
 
 
@@ -351,13 +659,19 @@ int32 GPS_APP_ReportRFTelemetry(const CFE_MSG_CommandHeader_t *Msg){
     uint8_t aux_byte = (uint8_t) GPS_APP_Data.satellites;
     uint8_t aux_array4[] = {aux_byte,0,0,0};
 
+    /* Ground speed, then course over ground and vertical rate */
+    uint8_t *aux_array5 = (uint8_t*)(&GPS_APP_Data.Vel.GroundSpeed);
+
+    uint16 aux_track[2] = {GPS_APP_Data.Vel.CourseCdeg, (uint16) GPS_APP_Data.Vel.VertRateCms};
+    uint8_t *aux_array6 = (uint8_t*)aux_track;
+
     for(int i=0;i<4;i++){
       GPS_APP_Data.OutData.byte_group_1[i] = aux_array1[i];
       GPS_APP_Data.OutData.byte_group_2[i] = aux_array2[i];
       GPS_APP_Data.OutData.byte_group_3[i] = aux_array3[i];
       GPS_APP_Data.OutData.byte_group_4[i] = aux_array4[i];
-      GPS_APP_Data.OutData.byte_group_5[i] = 0;
-      GPS_APP_Data.OutData.byte_group_6[i] = 0;
+      GPS_APP_Data.OutData.byte_group_5[i] = aux_array5[i];
+      GPS_APP_Data.OutData.byte_group_6[i] = aux_array6[i];
     }
 
     /*
@@ -366,9 +680,44 @@ int32 GPS_APP_ReportRFTelemetry(const CFE_MSG_CommandHeader_t *Msg){
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.OutData.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.OutData.TelemetryHeader), true);
 
+    /*
+    ** Send the same fix in ECEF and ENU alongside...
+    */
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.GeoTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.GeoTlm.TelemetryHeader), true);
+
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Convert the current fix to ECEF and, once a reference is set, to   */
+/*         the local ENU frame, ready for the next RF request.                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void GPS_APP_UpdateGeo(void)
+{
+    GPS_APP_GeoTlm_Payload_t *Geo = &GPS_APP_Data.GeoTlm.Payload;
+
+    CFE_ES_PerfLogEntry(GPS_APP_GEO_PERF_ID);
+
+    Geo->Latitude  = GPS_APP_Data.latitude;
+    Geo->Longitude = GPS_APP_Data.longitude;
+    Geo->Altitude  = GPS_APP_Data.altitude;
+
+    GPS_APP_Geo_LlaToEcef(&Geo->Latitude, &Geo->Longitude, &Geo->Altitude, &Geo->EcefX, &Geo->EcefY, &Geo->EcefZ,
+                          1);
+
+    if (Geo->EnuRefValid)
+    {
+        GPS_APP_Geo_EcefToEnu(&GPS_APP_Data.EnuRef, &Geo->EcefX, &Geo->EcefY, &Geo->EcefZ, &Geo->East, &Geo->North,
+                              &Geo->Up, 1);
+    }
+
+    CFE_ES_PerfLogExit(GPS_APP_GEO_PERF_ID);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /*  Purpose:                                                                  */
@@ -379,6 +728,8 @@ int32 GPS_APP_ReportRFTelemetry(const CFE_MSG_CommandHeader_t *Msg){
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 int32 GPS_APP_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg)
 {
+    GPS_APP_ReadPathStats_t ReadPathStats[GPS_APP_READ_PATH_COUNT];
+
     /*
     ** Get command execution counters...
     */
@@ -390,12 +741,143 @@ int32 GPS_APP_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg)
     GPS_APP_Data.HkTlm.Payload.altitude = GPS_APP_Data.altitude;
     GPS_APP_Data.HkTlm.Payload.satellites = GPS_APP_Data.satellites;
 
+    /*
+    ** Command pipe load...
+    */
+    GPS_APP_Data.HkTlm.Payload.LoadGenState      = GPS_APP_Data.Load.State;
+    GPS_APP_Data.HkTlm.Payload.LoadGenStep       = GPS_APP_Data.Load.Step;
+    GPS_APP_Data.HkTlm.Payload.MsgsHandled       = 0;
+    GPS_APP_Data.HkTlm.Payload.MsgsLost          = 0;
+    for (int i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+    {
+        GPS_APP_Data.HkTlm.Payload.MsgsHandled += GPS_APP_Data.Load.Mid[i].Handled;
+        GPS_APP_Data.HkTlm.Payload.MsgsLost += GPS_APP_Data.Load.Mid[i].Lost;
+    }
+    GPS_APP_Data.HkTlm.Payload.ServiceTimeMaxUs  = GPS_APP_Data.Load.ServiceTimeMaxUs;
+    GPS_APP_Data.HkTlm.Payload.QueueLatencyMaxUs = GPS_APP_Data.Load.QueueLatencyMaxUs;
+    GPS_APP_Data.HkTlm.Payload.LoadGenDropRate   = GPS_APP_Data.Load.DropRate;
+
+    /*
+    ** Geofence...
+    */
+    GPS_APP_Data.HkTlm.Payload.FenceInsideMask    = GPS_APP_Data.Fence.InsideMask;
+    GPS_APP_Data.HkTlm.Payload.FenceCandidates    = GPS_APP_Data.Fence.Candidates;
+    GPS_APP_Data.HkTlm.Payload.FenceEvalTimeUs    = GPS_APP_Data.Fence.EvalTimeUs;
+    GPS_APP_Data.HkTlm.Payload.FenceEvalTimeMaxUs = GPS_APP_Data.Fence.EvalTimeMaxUs;
+
+    /*
+    ** Warm start...
+    */
+    GPS_APP_Data.HkTlm.Payload.TtffMs    = GPS_APP_Data.Cds.TtffMs;
+    GPS_APP_Data.HkTlm.Payload.StartType = GPS_APP_Data.Cds.StartType;
+
+    /*
+    ** Pipelined cycle...
+    */
+    GPS_APP_Data.HkTlm.Payload.CycleEnabled      = GPS_APP_Data.Cycle.Enabled;
+    GPS_APP_Data.HkTlm.Payload.CycleCount        = GPS_APP_Data.Cycle.Cycles;
+    GPS_APP_Data.HkTlm.Payload.CycleLateCount    = GPS_APP_Data.Cycle.LateCount;
+    GPS_APP_Data.HkTlm.Payload.CycleTransferUs   = GPS_APP_Data.Cycle.TransferUs;
+    GPS_APP_Data.HkTlm.Payload.CycleLatencyUs    = GPS_APP_Data.Cycle.LatencyUs;
+    GPS_APP_Data.HkTlm.Payload.CycleLatencyMaxUs = GPS_APP_Data.Cycle.LatencyMaxUs;
+    GPS_APP_Data.HkTlm.Payload.CycleSkipped      = GPS_APP_Data.Cycle.Skipped;
+
+    /*
+    ** Read paths...
+    */
+    GPS_APP_Dev_GetStats(ReadPathStats);
+    GPS_APP_Data.HkTlm.Payload.ReadPath        = GPS_APP_Data.Dev.Path;
+    GPS_APP_Data.HkTlm.Payload.ReadRawAvgUs    = GPS_APP_Dev_AvgUs(&ReadPathStats[GPS_APP_READ_PATH_RAW]);
+    GPS_APP_Data.HkTlm.Payload.ReadRawMaxUs    = ReadPathStats[GPS_APP_READ_PATH_RAW].MaxUs;
+    GPS_APP_Data.HkTlm.Payload.ReadDeviceAvgUs = GPS_APP_Dev_AvgUs(&ReadPathStats[GPS_APP_READ_PATH_DEVICE]);
+    GPS_APP_Data.HkTlm.Payload.ReadDeviceMaxUs = ReadPathStats[GPS_APP_READ_PATH_DEVICE].MaxUs;
+
+    /*
+    ** Fix log...
+    */
+    GPS_APP_Data.HkTlm.Payload.LogRecords      = GPS_APP_Data.Log.Seq;
+    GPS_APP_Data.HkTlm.Payload.LogDropped      = GPS_APP_Data.Log.Dropped;
+    GPS_APP_Data.HkTlm.Payload.LogQueueHwm     = GPS_APP_Data.Log.QueueHwm;
+    GPS_APP_Data.HkTlm.Payload.LogBytesWritten = GPS_APP_Data.Log.BytesWritten;
+    GPS_APP_Data.HkTlm.Payload.LogWriteRateBps = GPS_APP_Log_WriteRate();
+    GPS_APP_Data.HkTlm.Payload.LogWriteErrors  = GPS_APP_Data.Log.WriteErrors;
+    GPS_APP_Data.HkTlm.Payload.LogQueryUs      = GPS_APP_Data.Log.QueryUs;
+    GPS_APP_Data.HkTlm.Payload.LogQueryBlocks  = GPS_APP_Data.Log.QueryBlocks;
+    GPS_APP_Data.HkTlm.Payload.LogQueryRecords = GPS_APP_Data.Log.QueryRecords;
+
+    /*
+    ** Estimator...
+    */
+    GPS_APP_Data.HkTlm.Payload.EstTicks       = GPS_APP_Data.Est.Ticks;
+    GPS_APP_Data.HkTlm.Payload.EstResets      = GPS_APP_Data.Est.Resets;
+    GPS_APP_Data.HkTlm.Payload.EstTickUs      = GPS_APP_Data.Est.TickUs;
+    GPS_APP_Data.HkTlm.Payload.EstTickMaxUs   = GPS_APP_Data.Est.TickMaxUs;
+    GPS_APP_Data.HkTlm.Payload.EstUpdateMaxUs = GPS_APP_Data.Est.UpdateMaxUs;
+
+    /*
+    ** Velocity...
+    */
+    GPS_APP_Data.HkTlm.Payload.GroundSpeed  = GPS_APP_Data.Vel.GroundSpeed;
+    GPS_APP_Data.HkTlm.Payload.CourseDeg    = GPS_APP_Data.Vel.CourseDeg;
+    GPS_APP_Data.HkTlm.Payload.VerticalRate = GPS_APP_Data.Vel.VertRate;
+    GPS_APP_Data.HkTlm.Payload.VelSource    = GPS_APP_Data.Vel.Source;
+    GPS_APP_Data.HkTlm.Payload.VelUs        = GPS_APP_Data.Vel.Us;
+    GPS_APP_Data.HkTlm.Payload.VelMaxUs     = GPS_APP_Data.Vel.MaxUs;
+
+    /*
+    ** Satellite table...
+    */
+    GPS_APP_Data.HkTlm.Payload.SvVisible      = GPS_APP_Data.Sv.Current.Count;
+    GPS_APP_Data.HkTlm.Payload.SvUsed         = GPS_APP_Sv_UsedCount();
+    GPS_APP_Data.HkTlm.Payload.SvErrors       = GPS_APP_Data.Sv.Errors;
+    GPS_APP_Data.HkTlm.Payload.SvEntriesSent  = GPS_APP_Data.Sv.EntriesSent;
+    GPS_APP_Data.HkTlm.Payload.SvLastPktBytes = GPS_APP_Data.Sv.LastPktBytes;
+
+    /*
+    ** Burst capture...
+    */
+    GPS_APP_Data.HkTlm.Payload.BurstState      = __atomic_load_n(&GPS_APP_Data.Burst.State, __ATOMIC_ACQUIRE);
+    GPS_APP_Data.HkTlm.Payload.BurstCaptured   = GPS_APP_Data.Burst.Captured;
+    GPS_APP_Data.HkTlm.Payload.BurstRejected   = GPS_APP_Data.Burst.Rejected;
+    GPS_APP_Data.HkTlm.Payload.BurstDuplicates = GPS_APP_Data.Burst.Duplicates;
+    GPS_APP_Data.HkTlm.Payload.BurstReadErrors = GPS_APP_Data.Burst.ReadErrors;
+    GPS_APP_Data.HkTlm.Payload.BurstRateHz     = GPS_APP_Burst_RateHz();
+    GPS_APP_Data.HkTlm.Payload.BurstDrained    = GPS_APP_Data.Burst.Drained;
+
+    /*
+    ** Fix validation...
+    */
+    GPS_APP_Data.HkTlm.Payload.ValidAccepted     = GPS_APP_Data.Valid.Accepted;
+    GPS_APP_Data.HkTlm.Payload.ValidRejectFinite = GPS_APP_Data.Valid.Rejects[GPS_APP_VALID_NOT_FINITE];
+    GPS_APP_Data.HkTlm.Payload.ValidRejectRange  = GPS_APP_Data.Valid.Rejects[GPS_APP_VALID_RANGE];
+    GPS_APP_Data.HkTlm.Payload.ValidRejectSats   = GPS_APP_Data.Valid.Rejects[GPS_APP_VALID_SATELLITES];
+    GPS_APP_Data.HkTlm.Payload.ValidRejectJump   = GPS_APP_Data.Valid.Rejects[GPS_APP_VALID_JUMP];
+
+    /*
+    ** Poll rate...
+    */
+    GPS_APP_Poll_Report();
+    GPS_APP_Data.HkTlm.Payload.PollMode          = GPS_APP_Data.Poll.Mode;
+    GPS_APP_Data.HkTlm.Payload.PollModeChanges   = GPS_APP_Data.Poll.ModeChanges;
+    GPS_APP_Data.HkTlm.Payload.PollNavRateErrors = GPS_APP_Data.Poll.NavRateErrors;
+    GPS_APP_Data.HkTlm.Payload.PollRateHz        = GPS_APP_Data.Poll.RateHz;
+    GPS_APP_Data.HkTlm.Payload.PollBusDuty       = GPS_APP_Data.Poll.BusDuty;
+
     /*
     ** Send housekeeping telemetry packet...
     */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.HkTlm.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.HkTlm.TelemetryHeader), true);
 
+    GPS_APP_Diag_Report();
+    GPS_APP_Stats_Report();
+
+    /*
+    ** Manage any pending table loads, validations, etc.
+    */
+    GPS_APP_Fence_Manage();
+    GPS_APP_Stream_Manage();
+
     return CFE_SUCCESS;
 }
 
@@ -426,11 +908,76 @@ int32 GPS_APP_ResetCounters(const GPS_APP_ResetCountersCmd_t *Msg)
     GPS_APP_Data.CmdCounter = 0;
     GPS_APP_Data.ErrCounter = 0;
 
+    GPS_APP_Load_ResetCounters();
+    GPS_APP_Data.Est.TickMaxUs   = 0;
+    GPS_APP_Data.Est.UpdateMaxUs = 0;
+    GPS_APP_Data.Vel.MaxUs       = 0;
+    CFE_EVS_ResetAllFilters();
+
     CFE_EVS_SendEvent(GPS_APP_COMMANDRST_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: RESET command");
 
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS set ENU reference command                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_SetEnuRef(const GPS_APP_SetEnuRefCmd_t *Msg)
+{
+    const GPS_APP_SetEnuRef_Payload_t *Ref = &Msg->Payload;
+
+    if (!(Ref->Latitude >= -90.0 && Ref->Latitude <= 90.0 && Ref->Longitude >= -180.0 && Ref->Longitude <= 180.0))
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_GEO_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: invalid ENU reference: lat = %f, lon = %f", Ref->Latitude, Ref->Longitude);
+        return CFE_SUCCESS;
+    }
+
+    GPS_APP_Geo_SetReference(&GPS_APP_Data.EnuRef, Ref->Latitude, Ref->Longitude, Ref->Altitude);
+    GPS_APP_Data.GeoTlm.Payload.EnuRefValid = true;
+
+    GPS_APP_UpdateGeo();
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_GEO_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: ENU reference set to lat = %f, lon = %f, alt = %f", Ref->Latitude, Ref->Longitude,
+                      Ref->Altitude);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS geodetic conversion self test command                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_GeoSelfTest(const GPS_APP_GeoSelfTestCmd_t *Msg)
+{
+    double MaxError    = 0;
+    uint32 FixesPerSec = 0;
+    int32  status;
+
+    status = GPS_APP_Geo_SelfTest(&MaxError, &FixesPerSec);
+    if (status != CFE_SUCCESS)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_GEO_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: geodetic self test FAILED, max error = %f m, %u fixes/s", MaxError,
+                          (unsigned int)FixesPerSec);
+        return status;
+    }
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_GEO_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: geodetic self test passed, max error = %f m, %u fixes/s", MaxError,
+                      (unsigned int)FixesPerSec);
+
+    return CFE_SUCCESS;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* Verify command packet length                                               */
@@ -465,3 +1012,24 @@ bool GPS_APP_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
 
     return result;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Microseconds from Start to End, clamped to zero if End is earlier          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 GPS_APP_DeltaUsec(OS_time_t Start, OS_time_t End)
+{
+    int64 Usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
+
+    if (Usec < 0)
+    {
+        Usec = 0;
+    }
+    else if (Usec > 0xFFFFFFFF)
+    {
+        Usec = 0xFFFFFFFF;
+    }
+
+    return (uint32)Usec;
+}
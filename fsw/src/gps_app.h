@@ -36,7 +36,25 @@
 
 #include "gps_app_perfids.h"
 #include "gps_app_msgids.h"
+#include "gps_app_platform_cfg.h"
 #include "gps_app_msg.h"
+#include "gps_app_load.h"
+#include "gps_app_geo.h"
+#include "gps_app_fence.h"
+#include "gps_app_cds.h"
+#include "gps_app_sample.h"
+#include "gps_app_cycle.h"
+#include "gps_app_dev.h"
+#include "gps_app_log.h"
+#include "gps_app_diag.h"
+#include "gps_app_stats.h"
+#include "gps_app_est.h"
+#include "gps_app_vel.h"
+#include "gps_app_sv.h"
+#include "gps_app_burst.h"
+#include "gps_app_valid.h"
+#include "gps_app_stream.h"
+#include "gps_app_poll.h"
 
 /***********************************************************************/
 
@@ -51,6 +69,8 @@ static const char genuC_path[] = "/dev/i2c-2.genuC-0";
 /***********************************************************************/
 #define GPS_APP_PIPE_DEPTH 32 /* Depth of the Command Pipe for Application */
 
+#define GPS_APP_EVENT_COUNTS 3 /* Filtered event IDs */
+
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
@@ -71,6 +91,12 @@ typedef struct
     */
     GPS_APP_HkTlm_t HkTlm;
     GPS_APP_OutData_t OutData;
+    GPS_APP_GeoTlm_t GeoTlm;
+    GPS_APP_DiagTlm_t DiagTlm;
+    GPS_APP_StatsTlm_t StatsTlm;
+    GPS_APP_EstTlm_t EstTlm;
+    GPS_APP_SvTlm_t SvTlm;
+    GPS_APP_BurstTlm_t BurstTlm;
 
     /*
     ** GPS Data...
@@ -80,6 +106,86 @@ typedef struct
     float altitude;
     uint8 satellites;
 
+    /*
+    ** Command pipe load accounting and load generator
+    */
+    GPS_APP_LoadData_t Load;
+
+    /*
+    ** Origin of the local ENU frame
+    */
+    GPS_APP_GeoRef_t EnuRef;
+
+    /*
+    ** Geofence engine
+    */
+    GPS_APP_FenceData_t Fence;
+
+    /*
+    ** Warm start persistence and time to first fix
+    */
+    GPS_APP_CdsData_t Cds;
+
+    /*
+    ** Pipelined read/publish cycle
+    */
+    GPS_APP_CycleData_t Cycle;
+
+    /*
+    ** Fix read paths
+    */
+    GPS_APP_DevData_t Dev;
+
+    /*
+    ** Onboard fix log
+    */
+    GPS_APP_LogData_t Log;
+
+    /*
+    ** Driver diagnostics
+    */
+    GPS_APP_DiagData_t Diag;
+
+    /*
+    ** Rolling position statistics
+    */
+    GPS_APP_StatsData_t Stats;
+
+    /*
+    ** Position/velocity estimator
+    */
+    GPS_APP_EstData_t Est;
+
+    /*
+    ** Speed, course and vertical rate
+    */
+    GPS_APP_VelData_t Vel;
+
+    /*
+    ** Satellite table
+    */
+    GPS_APP_SvData_t Sv;
+
+    /*
+    ** Burst capture
+    */
+    GPS_APP_BurstData_t Burst;
+
+    /*
+    ** Fix validation
+    */
+    GPS_APP_ValidData_t Valid;
+
+    /*
+    ** Output streams
+    */
+    GPS_APP_StreamData_t Stream;
+
+    /*
+    ** Adaptive poll rate
+    */
+    GPS_APP_PollData_t Poll;
+
     /*
     ** Run Status variable used in the main processing loop
     */
@@ -95,6 +201,8 @@ typedef struct
     */
     char   PipeName[CFE_MISSION_MAX_API_LEN];
     uint16 PipeDepth;
+
+    CFE_EVS_BinFilter_t EventFilters[GPS_APP_EVENT_COUNTS];
 } GPS_APP_Data_t;
 
 typedef union
@@ -115,11 +223,19 @@ int32 GPS_APP_Init(void);
 void  GPS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
 void  GPS_APP_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr);
 int32 GPS_APP_ReadSensor(const CFE_MSG_CommandHeader_t *Msg);
+int32 GPS_APP_AcquireSample(GPS_APP_Sample_t *Sample);
+bool  GPS_APP_CommitSample(const GPS_APP_Sample_t *Sample);
 int32 GPS_APP_ReportRFTelemetry(const CFE_MSG_CommandHeader_t *Msg);
 int32 GPS_APP_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg);
 int32 GPS_APP_ResetCounters(const GPS_APP_ResetCountersCmd_t *Msg);
 int32 GPS_APP_Noop(const GPS_APP_NoopCmd_t *Msg);
+int32 GPS_APP_SetEnuRef(const GPS_APP_SetEnuRefCmd_t *Msg);
+int32 GPS_APP_GeoSelfTest(const GPS_APP_GeoSelfTestCmd_t *Msg);
+void  GPS_APP_UpdateGeo(void);
+
+bool   GPS_APP_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
+uint32 GPS_APP_DeltaUsec(OS_time_t Start, OS_time_t End);
 
-bool GPS_APP_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
+extern GPS_APP_Data_t GPS_APP_Data;
 
 #endif /* GPS_APP_H */
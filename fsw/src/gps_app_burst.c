@@ -0,0 +1,385 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Commanded burst capture for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Create the burst task and its packet, the task waits for an arm command    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Burst_Init(void)
+{
+    GPS_APP_BurstData_t *Burst = &GPS_APP_Data.Burst;
+    int32                status;
+
+    memset(Burst, 0, sizeof(*Burst));
+
+    CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_Data.BurstTlm.TelemetryHeader), CFE_SB_ValueToMsgId(GPS_APP_BURST_TLM_MID),
+                 sizeof(GPS_APP_Data.BurstTlm));
+
+    status = OS_BinSemCreate(&Burst->StartSem, GPS_APP_BURST_SEM_NAME, OS_SEM_EMPTY, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating burst semaphore, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = CFE_ES_CreateChildTask(&Burst->TaskId, GPS_APP_BURST_TASK_NAME, GPS_APP_Burst_Task,
+                                    CFE_ES_TASK_STACK_ALLOCATE, GPS_APP_BURST_STACK_SIZE, GPS_APP_BURST_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating burst task, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Fixes per second achieved by the current or last capture                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+float GPS_APP_Burst_RateHz(void)
+{
+    const GPS_APP_BurstData_t *Burst = &GPS_APP_Data.Burst;
+
+    return (Burst->CaptureUs == 0) ? 0.0f : (float)((double)Burst->Captured * 1.0e6 / Burst->CaptureUs);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Reject a command while a capture or drain is running                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Burst_Busy(void)
+{
+    uint8 State = __atomic_load_n(&GPS_APP_Data.Burst.State, __ATOMIC_ACQUIRE);
+
+    if (State == GPS_APP_BURST_IDLE)
+    {
+        return false;
+    }
+
+    GPS_APP_Data.ErrCounter++;
+    CFE_EVS_SendEvent(GPS_APP_BURST_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: burst busy %s",
+                      (State == GPS_APP_BURST_CAPTURING) ? "capturing" : "draining");
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Hand the burst to the task                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Burst_Start(uint8 State)
+{
+    __atomic_store_n(&GPS_APP_Data.Burst.State, State, __ATOMIC_RELEASE);
+    OS_BinSemGive(GPS_APP_Data.Burst.StartSem);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS arm burst command                                                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_BurstArm(const GPS_APP_BurstArmCmd_t *Msg)
+{
+    GPS_APP_BurstData_t *             Burst = &GPS_APP_Data.Burst;
+    const GPS_APP_BurstArm_Payload_t *Arm   = &Msg->Payload;
+    uint32                            DurationMs;
+
+    if (Arm->DurationMs > GPS_APP_BURST_MAX_DURATION_MS)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_BURST_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: burst duration %u ms exceeds %u ms",
+                          (unsigned int)Arm->DurationMs, (unsigned int)GPS_APP_BURST_MAX_DURATION_MS);
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** The task only checks the duration between reads, so a longer period
+    ** would hold it, and every other burst command, past the end
+    */
+    DurationMs = (Arm->DurationMs == 0) ? GPS_APP_BURST_MAX_DURATION_MS : Arm->DurationMs;
+    if (Arm->PeriodMs > DurationMs)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_BURST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: burst period %u ms exceeds the %u ms duration", (unsigned int)Arm->PeriodMs,
+                          (unsigned int)DurationMs);
+        return CFE_SUCCESS;
+    }
+
+    if (Arm->MaxSamples > GPS_APP_BURST_RING_SIZE)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_BURST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: burst of %u fixes exceeds the %u fix ring", (unsigned int)Arm->MaxSamples,
+                          (unsigned int)GPS_APP_BURST_RING_SIZE);
+        return CFE_SUCCESS;
+    }
+
+    if (GPS_APP_Burst_Busy())
+    {
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** The task is idle, so the ring and counters can be reset from here.
+    ** Anything left from the previous burst is discarded.
+    */
+    Burst->DurationMs = DurationMs;
+    Burst->MaxSamples = (Arm->MaxSamples == 0) ? GPS_APP_BURST_RING_SIZE : Arm->MaxSamples;
+    Burst->PeriodMs   = Arm->PeriodMs;
+    Burst->Count      = 0;
+    Burst->DrainPos   = 0;
+    Burst->Captured   = 0;
+    Burst->Rejected   = 0;
+    Burst->Duplicates = 0;
+    Burst->ReadErrors = 0;
+    Burst->CaptureUs  = 0;
+    Burst->Drained    = 0;
+    Burst->Packets    = 0;
+    Burst->BurstId++;
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_BURST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: burst %u armed, %u ms or %u fixes, period %u ms", (unsigned int)Burst->BurstId,
+                      (unsigned int)Burst->DurationMs, (unsigned int)Burst->MaxSamples, (unsigned int)Burst->PeriodMs);
+
+    GPS_APP_Burst_Start(GPS_APP_BURST_CAPTURING);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS drain burst command                                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_BurstDrain(const GPS_APP_BurstDrainCmd_t *Msg)
+{
+    GPS_APP_BurstData_t *Burst = &GPS_APP_Data.Burst;
+    uint16               Rate  = Msg->Payload.PacketsPerSec;
+
+    if (Rate == 0 || Rate > GPS_APP_BURST_MAX_PKT_RATE)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_BURST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: burst drain rate %u packets/s not in 1 to %u", (unsigned int)Rate,
+                          (unsigned int)GPS_APP_BURST_MAX_PKT_RATE);
+        return CFE_SUCCESS;
+    }
+
+    if (GPS_APP_Burst_Busy())
+    {
+        return CFE_SUCCESS;
+    }
+
+    if (Burst->DrainPos == Burst->Count)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_BURST_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: burst ring is empty");
+        return CFE_SUCCESS;
+    }
+
+    Burst->PacketsPerSec = Rate;
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_BURST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: draining burst %u, %u fixes at %u packets/s", (unsigned int)Burst->BurstId,
+                      (unsigned int)(Burst->Count - Burst->DrainPos), (unsigned int)Rate);
+
+    GPS_APP_Burst_Start(GPS_APP_BURST_DRAINING);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Read fixes back to back into the ring until the duration or the    */
+/*         sample count runs out. Runs in the burst task.                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Burst_Capture(void)
+{
+    GPS_APP_BurstData_t *  Burst   = &GPS_APP_Data.Burst;
+    uint32                 LimitUs = Burst->DurationMs * 1000;
+    GPS_APP_BurstRecord_t *Rec;
+    GPS_APP_Sample_t       Sample;
+    GPS_APP_Sample_t       Last;
+    bool                   HaveLast = false;
+    CFE_TIME_SysTime_t     Now;
+    OS_time_t              StartTime;
+    OS_time_t              Time;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    while (Burst->Count < Burst->MaxSamples && Burst->CaptureUs < LimitUs &&
+           GPS_APP_Data.RunStatus == CFE_ES_RunStatus_APP_RUN)
+    {
+        if (GPS_APP_AcquireSample(&Sample) != CFE_SUCCESS)
+        {
+            Burst->ReadErrors++;
+        }
+        else if (GPS_APP_Valid_Screen(&Sample) != GPS_APP_VALID_PASS)
+        {
+            /*
+            ** Drained fixes are published, so they get the same per-sample
+            ** checks as a committed one. The jump check needs the main
+            ** task's anchor and is left out.
+            */
+            Burst->Rejected++;
+        }
+        else if (HaveLast && Sample.latitude == Last.latitude && Sample.longitude == Last.longitude &&
+                 Sample.altitude == Last.altitude)
+        {
+            /*
+            ** The receiver has not produced a new fix since the last read
+            */
+            Burst->Duplicates++;
+        }
+        else
+        {
+            Now = CFE_TIME_GetTime();
+
+            Rec             = &Burst->Ring[Burst->Count];
+            Rec->Seconds    = Now.Seconds;
+            Rec->Subseconds = Now.Subseconds;
+            Rec->latitude   = Sample.latitude;
+            Rec->longitude  = Sample.longitude;
+            Rec->altitude   = Sample.altitude;
+            Rec->satellites = Sample.satellites;
+
+            Burst->Count++;
+            Burst->Captured++;
+            Last     = Sample;
+            HaveLast = true;
+        }
+
+        if (Burst->PeriodMs > 0)
+        {
+            OS_TaskDelay(Burst->PeriodMs);
+        }
+
+        CFE_PSP_GetTime(&Time);
+        Burst->CaptureUs = GPS_APP_DeltaUsec(StartTime, Time);
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_BURST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: burst %u done, %u fixes in %u ms (%.1f Hz), %u invalid, %u repeated, %u read errors",
+                      (unsigned int)Burst->BurstId, (unsigned int)Burst->Captured,
+                      (unsigned int)(Burst->CaptureUs / 1000), GPS_APP_Burst_RateHz(), (unsigned int)Burst->Rejected,
+                      (unsigned int)Burst->Duplicates, (unsigned int)Burst->ReadErrors);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Send the rest of the ring, one batch per packet at the commanded   */
+/*         packet rate. Runs in the burst task.                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Burst_Drain(void)
+{
+    GPS_APP_BurstData_t *       Burst   = &GPS_APP_Data.Burst;
+    GPS_APP_BurstTlm_Payload_t *Pkt     = &GPS_APP_Data.BurstTlm.Payload;
+    uint32                      DelayMs = 1000 / Burst->PacketsPerSec;
+    uint32                      n;
+    size_t                      Size;
+
+    while (Burst->DrainPos < Burst->Count && GPS_APP_Data.RunStatus == CFE_ES_RunStatus_APP_RUN)
+    {
+        n = Burst->Count - Burst->DrainPos;
+        if (n > GPS_APP_BURST_BATCH)
+        {
+            n = GPS_APP_BURST_BATCH;
+        }
+
+        memcpy(Pkt->Records, &Burst->Ring[Burst->DrainPos], n * sizeof(GPS_APP_BurstRecord_t));
+        Pkt->BurstId    = Burst->BurstId;
+        Pkt->FirstIndex = Burst->DrainPos;
+        Pkt->NumRecords = n;
+        Pkt->Remaining  = Burst->Count - Burst->DrainPos - n;
+
+        Size = offsetof(GPS_APP_BurstTlm_t, Payload.Records) + n * sizeof(GPS_APP_BurstRecord_t);
+        CFE_MSG_SetSize(CFE_MSG_PTR(GPS_APP_Data.BurstTlm.TelemetryHeader), Size);
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.BurstTlm.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.BurstTlm.TelemetryHeader), true);
+
+        Burst->DrainPos += n;
+        Burst->Drained += n;
+        Burst->Packets++;
+
+        if (Burst->DrainPos < Burst->Count)
+        {
+            OS_TaskDelay(DelayMs);
+        }
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_BURST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: burst %u drained, %u fixes in %u packets", (unsigned int)Burst->BurstId,
+                      (unsigned int)Burst->Drained, (unsigned int)Burst->Packets);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Burst child task. Each release runs one capture or one drain and   */
+/*         returns the burst to idle.                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Burst_Task(void)
+{
+    GPS_APP_BurstData_t *Burst = &GPS_APP_Data.Burst;
+
+    while (OS_BinSemTake(Burst->StartSem) == OS_SUCCESS)
+    {
+        if (__atomic_load_n(&Burst->State, __ATOMIC_ACQUIRE) == GPS_APP_BURST_CAPTURING)
+        {
+            GPS_APP_Burst_Capture();
+        }
+        else
+        {
+            GPS_APP_Burst_Drain();
+        }
+
+        __atomic_store_n(&Burst->State, GPS_APP_BURST_IDLE, __ATOMIC_RELEASE);
+
+        if (GPS_APP_Data.RunStatus != CFE_ES_RunStatus_APP_RUN)
+        {
+            break;
+        }
+    }
+
+    CFE_ES_ExitChildTask();
+}
@@ -0,0 +1,80 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Commanded burst capture for the GPS App
+ *
+ * An arm command releases the burst child task, which reads fixes back to
+ * back into a preallocated RAM ring until the commanded duration or sample
+ * count is reached. Reads that return the same fix as the one before (the
+ * bus outrunning the receiver's update rate) are counted but not stored, as
+ * are fixes that fail the per-sample validation checks. The sample count is
+ * limited to the ring size, so a burst never overruns the ring, and the
+ * period to the duration, so the task is never parked past the end of it.
+ * A drain command then has the same task send the ring as batched packets,
+ * paced to the commanded packet rate so the burst can be downlinked without
+ * flooding the link.
+ */
+
+#ifndef GPS_APP_BURST_H
+#define GPS_APP_BURST_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_platform_cfg.h"
+
+typedef struct
+{
+    CFE_ES_TaskId_t TaskId;
+    osal_id_t       StartSem;
+    uint8           State; /* GPS_APP_BURST_IDLE, _CAPTURING or _DRAINING */
+
+    /*
+    ** Set by the command before the task is released
+    */
+    uint32 DurationMs;
+    uint32 MaxSamples;
+    uint32 PeriodMs;
+    uint16 PacketsPerSec;
+
+    /*
+    ** Ring, written and drained only by the burst task
+    */
+    GPS_APP_BurstRecord_t Ring[GPS_APP_BURST_RING_SIZE];
+    uint32                Count;    /* Records in the ring */
+    uint32                DrainPos; /* Next record to send */
+
+    uint32 BurstId;    /* Bursts armed since the app started */
+    uint32 Captured;
+    uint32 Rejected;   /* Fixes that failed the per-sample validation checks */
+    uint32 Duplicates; /* Reads that repeated the previous fix */
+    uint32 ReadErrors;
+    uint32 CaptureUs;  /* Length of the last capture */
+    uint32 Drained;    /* Records sent from the ring */
+    uint32 Packets;
+} GPS_APP_BurstData_t;
+
+int32 GPS_APP_Burst_Init(void);
+float GPS_APP_Burst_RateHz(void);
+int32 GPS_APP_BurstArm(const GPS_APP_BurstArmCmd_t *Msg);
+int32 GPS_APP_BurstDrain(const GPS_APP_BurstDrainCmd_t *Msg);
+void  GPS_APP_Burst_Task(void);
+
+#endif /* GPS_APP_BURST_H */
@@ -0,0 +1,249 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Warm start persistence for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/*
+** Seconds per GPS week
+*/
+#define GPS_APP_GPS_WEEK_SECS 604800
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Little-endian field packing for UBX payloads                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Cds_PutU16(uint8 *Buf, uint16 Value)
+{
+    Buf[0] = (uint8)(Value & 0xFF);
+    Buf[1] = (uint8)(Value >> 8);
+}
+
+static void GPS_APP_Cds_PutU32(uint8 *Buf, uint32 Value)
+{
+    Buf[0] = (uint8)(Value & 0xFF);
+    Buf[1] = (uint8)((Value >> 8) & 0xFF);
+    Buf[2] = (uint8)((Value >> 16) & 0xFF);
+    Buf[3] = (uint8)(Value >> 24);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Send the restored fix and the current time to the receiver as a    */
+/*         UBX AID-INI message, through the uC that owns its serial port.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_Cds_SendAiding(const GPS_APP_CdsBlock_t *Block)
+{
+    uint8              Frame[GPS_APP_UBX_FRAME_LEN(GPS_APP_UBX_AID_INI_LEN)];
+    uint8 *            Payload = &Frame[6];
+    uint8 *            FramePtr = Frame;
+    CFE_TIME_SysTime_t Now;
+    OS_time_t          StartTime;
+    OS_time_t          EndTime;
+    uint32             GpsSecs;
+    uint8              CkA = 0;
+    uint8              CkB = 0;
+    uint32             i;
+    int                rc;
+
+    memset(Frame, 0, sizeof(Frame));
+
+    Frame[0] = GPS_APP_UBX_SYNC1;
+    Frame[1] = GPS_APP_UBX_SYNC2;
+    Frame[2] = GPS_APP_UBX_CLASS_AID;
+    Frame[3] = GPS_APP_UBX_ID_AID_INI;
+    GPS_APP_Cds_PutU16(&Frame[4], GPS_APP_UBX_AID_INI_LEN);
+
+    /*
+    ** Position as lat/lon in 1e-7 degrees and altitude in cm
+    */
+    GPS_APP_Cds_PutU32(&Payload[0], (uint32)(int32)(Block->Latitude * 1e7));
+    GPS_APP_Cds_PutU32(&Payload[4], (uint32)(int32)(Block->Longitude * 1e7));
+    GPS_APP_Cds_PutU32(&Payload[8], (uint32)(int32)(Block->Altitude * 100.0f));
+    GPS_APP_Cds_PutU32(&Payload[12], GPS_APP_AID_POS_ACC_CM);
+
+    /*
+    ** Time as GPS week and time of week
+    */
+    Now     = CFE_TIME_GetTime();
+    GpsSecs = Now.Seconds + GPS_APP_CFE_TO_GPS_EPOCH_SECS;
+    GPS_APP_Cds_PutU16(&Payload[18], (uint16)(GpsSecs / GPS_APP_GPS_WEEK_SECS));
+    GPS_APP_Cds_PutU32(&Payload[20],
+                       (GpsSecs % GPS_APP_GPS_WEEK_SECS) * 1000 + CFE_TIME_Sub2MicroSecs(Now.Subseconds) / 1000);
+    GPS_APP_Cds_PutU32(&Payload[28], GPS_APP_AID_TIME_ACC_MS);
+
+    GPS_APP_Cds_PutU32(&Payload[44], GPS_APP_UBX_AID_INI_POS | GPS_APP_UBX_AID_INI_TIME | GPS_APP_UBX_AID_INI_LLA);
+
+    /*
+    ** 8-bit Fletcher checksum over class, id, length and payload
+    */
+    for (i = 2; i < sizeof(Frame) - 2; i++)
+    {
+        CkA += Frame[i];
+        CkB += CkA;
+    }
+    Frame[sizeof(Frame) - 2] = CkA;
+    Frame[sizeof(Frame) - 1] = CkB;
+
+    CFE_PSP_GetTime(&StartTime);
+    rc = uC_set_bytes(UC_ADDRESS, &FramePtr, sizeof(Frame));
+    CFE_PSP_GetTime(&EndTime);
+    GPS_APP_Dev_AccountBus(GPS_APP_DeltaUsec(StartTime, EndTime));
+
+    return rc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Register the CDS block. After a processor reset it already holds   */
+/*         the last fix, which is restored and optionally sent as aiding if   */
+/*         it is recent enough for the claimed accuracy to hold. Failures     */
+/*         only cost the warm start, so they are not fatal.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Cds_Init(void)
+{
+    GPS_APP_CdsData_t *Cds = &GPS_APP_Data.Cds;
+    CFE_TIME_SysTime_t Now;
+    int32              status;
+
+    memset(Cds, 0, sizeof(*Cds));
+    Cds->StartType = GPS_APP_START_COLD;
+    CFE_PSP_GetTime(&Cds->StartTime);
+
+    status = CFE_ES_RegisterCDS(&Cds->Handle, sizeof(Cds->Block), GPS_APP_CDS_NAME);
+    if (status == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        Cds->Registered = true;
+
+        status = CFE_ES_RestoreFromCDS(&Cds->Block, Cds->Handle);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(GPS_APP_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "GPS: error restoring last fix from CDS, RC = 0x%08lX", (unsigned long)status);
+            memset(&Cds->Block, 0, sizeof(Cds->Block));
+        }
+    }
+    else if (status == CFE_SUCCESS)
+    {
+        Cds->Registered = true;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(GPS_APP_CDS_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: error registering CDS, RC = 0x%08lX",
+                          (unsigned long)status);
+        return CFE_SUCCESS;
+    }
+
+    if (!Cds->Block.Valid)
+    {
+        return CFE_SUCCESS;
+    }
+
+    GPS_APP_Data.latitude   = Cds->Block.Latitude;
+    GPS_APP_Data.longitude  = Cds->Block.Longitude;
+    GPS_APP_Data.altitude   = Cds->Block.Altitude;
+    GPS_APP_Data.satellites = 0; /* Nothing is tracked yet */
+    Cds->StartType          = GPS_APP_START_WARM;
+
+    /*
+    ** A fix from before the clock was set has no known age, treat it as old
+    */
+    Now = CFE_TIME_GetTime();
+    if (GPS_APP_AIDING_ENABLED &&
+        (Now.Seconds < Cds->Block.FixTime.Seconds || Now.Seconds - Cds->Block.FixTime.Seconds > GPS_APP_AID_MAX_AGE_S))
+    {
+        CFE_EVS_SendEvent(GPS_APP_CDS_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "GPS: last fix from %u s is too old to send as aiding at %u s",
+                          (unsigned int)Cds->Block.FixTime.Seconds, (unsigned int)Now.Seconds);
+    }
+    else if (GPS_APP_AIDING_ENABLED)
+    {
+        status = GPS_APP_Cds_SendAiding(&Cds->Block);
+        if (status == 0)
+        {
+            Cds->StartType = GPS_APP_START_AIDED;
+        }
+        else
+        {
+            CFE_EVS_SendEvent(GPS_APP_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "GPS: error sending AID-INI to receiver, RC = %d", (int)status);
+        }
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_CDS_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: %s start from lat = %f, lon = %f, alt = %f (previous TTFF %u ms)",
+                      (Cds->StartType == GPS_APP_START_AIDED) ? "aided" : "warm", Cds->Block.Latitude,
+                      Cds->Block.Longitude, Cds->Block.Altitude, (unsigned int)Cds->Block.LastTtffMs);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Save a good fix to the CDS, and time the first one.                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Cds_RecordFix(void)
+{
+    GPS_APP_CdsData_t *Cds = &GPS_APP_Data.Cds;
+    OS_time_t          Now;
+
+    if (GPS_APP_Data.satellites == 0)
+    {
+        return;
+    }
+
+    if (!Cds->HaveFix)
+    {
+        CFE_PSP_GetTime(&Now);
+        Cds->HaveFix = true;
+        Cds->TtffMs  = GPS_APP_DeltaUsec(Cds->StartTime, Now) / 1000;
+
+        CFE_EVS_SendEvent(GPS_APP_CDS_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: first fix after %u ms",
+                          (unsigned int)Cds->TtffMs);
+    }
+
+    if (!Cds->Registered)
+    {
+        return;
+    }
+
+    Cds->Block.Latitude   = GPS_APP_Data.latitude;
+    Cds->Block.Longitude  = GPS_APP_Data.longitude;
+    Cds->Block.Altitude   = GPS_APP_Data.altitude;
+    Cds->Block.Satellites = GPS_APP_Data.satellites;
+    Cds->Block.Valid      = true;
+    Cds->Block.FixTime    = CFE_TIME_GetTime();
+    Cds->Block.LastTtffMs = Cds->TtffMs;
+
+    CFE_ES_CopyToCDS(Cds->Handle, &Cds->Block);
+}
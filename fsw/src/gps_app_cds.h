@@ -0,0 +1,86 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Warm start persistence for the GPS App
+ *
+ * The last good fix is kept in a Critical Data Store block so it survives a
+ * processor reset. On restart it is restored into the app and, if enabled
+ * and no older than GPS_APP_AID_MAX_AGE_S, sent to the receiver as UBX
+ * AID-INI so it can skip the cold start search.
+ * Time to first fix since the app started is measured either way.
+ */
+
+#ifndef GPS_APP_CDS_H
+#define GPS_APP_CDS_H
+
+#include "cfe.h"
+
+/*
+** How the app started, reported in housekeeping
+*/
+#define GPS_APP_START_COLD  0 /* Nothing in the CDS */
+#define GPS_APP_START_WARM  1 /* Last fix restored from the CDS */
+#define GPS_APP_START_AIDED 2 /* Restored and sent to the receiver as aiding */
+
+/*
+** UBX AID-INI framing
+*/
+#define GPS_APP_UBX_SYNC1         0xB5
+#define GPS_APP_UBX_SYNC2         0x62
+#define GPS_APP_UBX_CLASS_AID     0x0B
+#define GPS_APP_UBX_ID_AID_INI    0x01
+#define GPS_APP_UBX_AID_INI_LEN   48
+#define GPS_APP_UBX_AID_INI_POS   0x0001 /* flags: position valid */
+#define GPS_APP_UBX_AID_INI_TIME  0x0002 /* flags: time valid */
+#define GPS_APP_UBX_AID_INI_LLA   0x0020 /* flags: position is lat/lon/alt */
+#define GPS_APP_UBX_FRAME_LEN(n)  ((n) + 8) /* sync, class, id, length, payload, checksum */
+
+/*
+** Block kept in the CDS
+*/
+typedef struct
+{
+    float              Latitude;
+    float              Longitude;
+    float              Altitude;
+    uint8              Satellites;
+    uint8              Valid;
+    uint8              spare[2];
+    CFE_TIME_SysTime_t FixTime;
+    uint32             LastTtffMs; /* TTFF of the run that wrote this block */
+} GPS_APP_CdsBlock_t;
+
+typedef struct
+{
+    CFE_ES_CDSHandle_t Handle;
+    bool               Registered;
+    GPS_APP_CdsBlock_t Block;
+
+    OS_time_t StartTime;
+    bool      HaveFix;
+    uint32    TtffMs;
+    uint8     StartType;
+} GPS_APP_CdsData_t;
+
+int32 GPS_APP_Cds_Init(void);
+void  GPS_APP_Cds_RecordFix(void);
+
+#endif /* GPS_APP_CDS_H */
@@ -0,0 +1,260 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Pipelined read/publish cycle for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Create the reader task and its semaphores, cycle mode starts disabled      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Cycle_Init(void)
+{
+    GPS_APP_CycleData_t *Cycle = &GPS_APP_Data.Cycle;
+    int32                status;
+
+    memset(Cycle, 0, sizeof(*Cycle));
+    Cycle->PhaseOffsetMs = GPS_APP_CYCLE_DEFAULT_PHASE_MS;
+
+    status = OS_BinSemCreate(&Cycle->StartSem, GPS_APP_CYCLE_SEM_NAME, OS_SEM_EMPTY, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating cycle semaphore, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = OS_MutSemCreate(&Cycle->SampleMutex, GPS_APP_CYCLE_MUTEX_NAME, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating cycle mutex, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = CFE_ES_CreateChildTask(&Cycle->TaskId, GPS_APP_READER_TASK_NAME, GPS_APP_Cycle_ReaderTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE, GPS_APP_READER_STACK_SIZE,
+                                    GPS_APP_READER_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating reader task, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Scheduler wakeup in cycle mode: publish the sample that finished   */
+/*         during the last cycle, then start the transfer for the next one    */
+/*         if the adaptive poll rate wants a read on this wakeup.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Cycle_Run(const CFE_MSG_CommandHeader_t *Msg)
+{
+    GPS_APP_CycleData_t *Cycle = &GPS_APP_Data.Cycle;
+    GPS_APP_Sample_t     Sample;
+    OS_time_t            PublishTime;
+    int32                ReadStatus;
+    bool                 InFlight;
+    bool                 Ready;
+
+    if (!Cycle->Enabled)
+    {
+        return CFE_SUCCESS;
+    }
+
+    Cycle->Cycles++;
+
+    OS_MutSemTake(Cycle->SampleMutex);
+    InFlight   = Cycle->InFlight;
+    Ready      = Cycle->Ready;
+    ReadStatus = Cycle->ReadStatus;
+    Sample     = Cycle->Sample;
+    if (Ready && Cycle->SampleGeneration != Cycle->Generation)
+    {
+        /*
+        ** Released before the last mode change, drop it
+        */
+        Ready = false;
+    }
+    if (!InFlight)
+    {
+        Cycle->Ready = false;
+    }
+    OS_MutSemGive(Cycle->SampleMutex);
+
+    /*
+    ** The read started last cycle has not finished, so there is nothing new
+    ** to publish and the bus is still busy
+    */
+    if (InFlight)
+    {
+        Cycle->LateCount++;
+        return CFE_SUCCESS;
+    }
+
+    if (Ready)
+    {
+        if (ReadStatus != CFE_SUCCESS)
+        {
+            Cycle->ReadErrors++;
+        }
+        else if (GPS_APP_CommitSample(&Sample))
+        {
+            GPS_APP_ReportRFTelemetry(Msg);
+
+            CFE_PSP_GetTime(&PublishTime);
+            Cycle->LatencyUs = GPS_APP_DeltaUsec(Sample.AcquiredTime, PublishTime);
+            if (Cycle->LatencyUs > Cycle->LatencyMaxUs)
+            {
+                Cycle->LatencyMaxUs = Cycle->LatencyUs;
+            }
+
+            GPS_APP_Poll_Update(&Sample);
+        }
+    }
+
+    /*
+    ** Only this task releases the reader, so nothing can start a transfer
+    ** between the check above and here
+    */
+    if (!GPS_APP_Poll_Due())
+    {
+        return CFE_SUCCESS;
+    }
+
+    OS_MutSemTake(Cycle->SampleMutex);
+    Cycle->InFlight          = true;
+    Cycle->ReleaseGeneration = Cycle->Generation;
+    OS_MutSemGive(Cycle->SampleMutex);
+
+    OS_BinSemGive(Cycle->StartSem);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS set cycle mode command                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_SetCycle(const GPS_APP_SetCycleCmd_t *Msg)
+{
+    GPS_APP_CycleData_t *Cycle = &GPS_APP_Data.Cycle;
+
+    if (Msg->Payload.PhaseOffsetMs > GPS_APP_CYCLE_MAX_PHASE_MS)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_CYCLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: cycle phase offset %u ms exceeds %u ms", (unsigned int)Msg->Payload.PhaseOffsetMs,
+                          (unsigned int)GPS_APP_CYCLE_MAX_PHASE_MS);
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** Don't publish a sample left over from before the mode change, including
+    ** one whose transfer is still in flight
+    */
+    OS_MutSemTake(Cycle->SampleMutex);
+    Cycle->Ready = false;
+    Cycle->Generation++;
+    OS_MutSemGive(Cycle->SampleMutex);
+
+    Cycle->Enabled       = (Msg->Payload.Enable != 0);
+    Cycle->PhaseOffsetMs = Msg->Payload.PhaseOffsetMs;
+    Cycle->LatencyMaxUs  = 0;
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_CYCLE_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: cycle mode %s, phase offset %u ms",
+                      Cycle->Enabled ? "enabled" : "disabled", (unsigned int)Cycle->PhaseOffsetMs);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* True if cycle mode owns the read and publish, counting the skipped wakeup  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool GPS_APP_Cycle_Skip(void)
+{
+    GPS_APP_CycleData_t *Cycle = &GPS_APP_Data.Cycle;
+
+    if (!Cycle->Enabled)
+    {
+        return false;
+    }
+
+    Cycle->Skipped++;
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Reader child task. Each release waits the phase offset, does one   */
+/*         bus transfer and leaves the result for the next cycle wakeup.      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Cycle_ReaderTask(void)
+{
+    GPS_APP_CycleData_t *Cycle = &GPS_APP_Data.Cycle;
+    GPS_APP_Sample_t     Sample;
+    OS_time_t            StartTime;
+    OS_time_t            EndTime;
+    uint32               Generation;
+    int32                status;
+
+    while (OS_BinSemTake(Cycle->StartSem) == OS_SUCCESS)
+    {
+        OS_MutSemTake(Cycle->SampleMutex);
+        Generation = Cycle->ReleaseGeneration;
+        OS_MutSemGive(Cycle->SampleMutex);
+
+        if (Cycle->PhaseOffsetMs > 0)
+        {
+            OS_TaskDelay(Cycle->PhaseOffsetMs);
+        }
+
+        CFE_PSP_GetTime(&StartTime);
+        status = GPS_APP_AcquireSample(&Sample);
+        CFE_PSP_GetTime(&EndTime);
+
+        OS_MutSemTake(Cycle->SampleMutex);
+        Cycle->Sample           = Sample;
+        Cycle->SampleGeneration = Generation;
+        Cycle->ReadStatus       = status;
+        Cycle->TransferUs       = GPS_APP_DeltaUsec(StartTime, EndTime);
+        Cycle->InFlight         = false;
+        Cycle->Ready            = true;
+        OS_MutSemGive(Cycle->SampleMutex);
+    }
+
+    CFE_ES_ExitChildTask();
+}
@@ -0,0 +1,80 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Pipelined read/publish cycle for the GPS App
+ *
+ * In cycle mode one scheduler wakeup (GPS_APP_CYCLE_MID) does both stages:
+ * it commits and publishes sample k, which a reader child task finished
+ * during the previous cycle, and then releases the reader to fetch sample
+ * k+1. The reader waits the commanded phase offset before starting the bus
+ * transfer, so the offset can be set to land each sample just ahead of the
+ * next wakeup and keep the fix-to-packet latency short. The adaptive poll
+ * rate applies here too: a wakeup only releases the reader when a read is
+ * due, and each published fix updates the poll mode. While cycle mode is
+ * on, the normal GPS_APP_READ_MID and GPS_APP_SEND_RF_MID wakeups are
+ * ignored so each period has one read and one RF packet.
+ */
+
+#ifndef GPS_APP_CYCLE_H
+#define GPS_APP_CYCLE_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_sample.h"
+
+typedef struct
+{
+    CFE_ES_TaskId_t TaskId;
+    osal_id_t       StartSem;
+    osal_id_t       SampleMutex;
+
+    bool   Enabled;
+    uint32 PhaseOffsetMs;
+
+    /*
+    ** Hand-off between the reader and the main task, under SampleMutex.
+    ** Generation is bumped on every mode change; a sample is only published
+    ** if it was released in the current one.
+    */
+    bool             InFlight;
+    bool             Ready;
+    uint32           Generation;
+    uint32           ReleaseGeneration; /* Generation of the transfer in flight */
+    uint32           SampleGeneration;  /* Generation Sample was released in */
+    int32            ReadStatus;
+    GPS_APP_Sample_t Sample;
+
+    uint32 Cycles;
+    uint32 LateCount;     /* Wakeups that found the previous read still in flight */
+    uint32 Skipped;       /* READ and SEND_RF wakeups ignored while enabled */
+    uint32 ReadErrors;
+    uint32 TransferUs;    /* Duration of the last bus transfer */
+    uint32 LatencyUs;     /* Transfer complete to RF packet sent, last cycle */
+    uint32 LatencyMaxUs;
+} GPS_APP_CycleData_t;
+
+int32 GPS_APP_Cycle_Init(void);
+int32 GPS_APP_Cycle_Run(const CFE_MSG_CommandHeader_t *Msg);
+int32 GPS_APP_SetCycle(const GPS_APP_SetCycleCmd_t *Msg);
+bool  GPS_APP_Cycle_Skip(void);
+void  GPS_APP_Cycle_ReaderTask(void);
+
+#endif /* GPS_APP_CYCLE_H */
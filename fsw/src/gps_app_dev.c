@@ -0,0 +1,379 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Fix read paths for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Register the genuC device and open it once. A node left by an      */
+/*         earlier instance of the app points at that instance's handlers,    */
+/*         so it is removed first and never reused. Without the device the    */
+/*         app keeps working on the raw bus path.                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Dev_Init(void)
+{
+    GPS_APP_DevData_t *Dev = &GPS_APP_Data.Dev;
+    int32              status;
+    int                rv;
+
+    memset(Dev, 0, sizeof(*Dev));
+    Dev->Fd   = -1;
+    Dev->Path = GPS_APP_READ_PATH_RAW;
+
+    status = OS_MutSemCreate(&Dev->StatsMutex, GPS_APP_DEV_MUTEX_NAME, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating read path mutex, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = OS_BinSemCreate(&Dev->BenchSem, GPS_APP_BENCH_SEM_NAME, OS_SEM_EMPTY, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating benchmark semaphore, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = CFE_ES_CreateChildTask(&Dev->BenchTaskId, GPS_APP_BENCH_TASK_NAME, GPS_APP_Dev_BenchTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE, GPS_APP_BENCH_STACK_SIZE, GPS_APP_BENCH_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating benchmark task, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    unlink(genuC_path);
+
+    rv = i2c_dev_register_uC(bus_path, genuC_path);
+    if (rv == 0)
+    {
+        Dev->Fd = open(genuC_path, O_RDONLY);
+    }
+
+    if (Dev->Fd < 0)
+    {
+        CFE_EVS_SendEvent(GPS_APP_GENUC_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: %s unavailable (register rc = %d, errno = %d), reading through %s", genuC_path, rv,
+                          errno, bus_path);
+        return CFE_SUCCESS;
+    }
+
+    Dev->Path = GPS_APP_READ_PATH_DEVICE;
+
+    CFE_EVS_SendEvent(GPS_APP_DEV_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: reading fixes through %s",
+                      genuC_path);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Close and remove the genuC device on app exit                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Dev_Close(void)
+{
+    int Fd = GPS_APP_Data.Dev.Fd;
+
+    GPS_APP_Data.Dev.Fd = -1;
+    if (Fd >= 0)
+    {
+        close(Fd);
+        unlink(genuC_path);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Add the time of one uC transfer, from any task, to the bus busy time       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Dev_AccountBus(uint32 Usec)
+{
+    __atomic_add_fetch(&GPS_APP_Data.Dev.BusUs, Usec, __ATOMIC_RELAXED);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Bus busy time since the last call                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 GPS_APP_Dev_TakeBusUs(void)
+{
+    return __atomic_exchange_n(&GPS_APP_Data.Dev.BusUs, 0, __ATOMIC_RELAXED);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Fetch Size raw fix bytes over the given path, Usec is the transfer time    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_Dev_Transfer(uint8 Path, uint8 *Raw, uint16 Size, uint32 *Usec)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    uint8_t * tmp    = NULL;
+    int32     status = CFE_SUCCESS;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    if (Path == GPS_APP_READ_PATH_DEVICE)
+    {
+        if (read(GPS_APP_Data.Dev.Fd, Raw, Size) != Size)
+        {
+            status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+    else
+    {
+        if (uC_read_bytes(Size, &tmp) != 0 || tmp == NULL)
+        {
+            status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+        else
+        {
+            memcpy(Raw, tmp, Size);
+        }
+        free(tmp);
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+    *Usec = GPS_APP_DeltaUsec(StartTime, EndTime);
+    GPS_APP_Dev_AccountBus(*Usec);
+
+    if (status != CFE_SUCCESS)
+    {
+        GPS_APP_Diag_FetchFailed(Path);
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Add one transfer time to a path's statistics                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Dev_Accumulate(GPS_APP_ReadPathStats_t *Stats, uint32 Usec)
+{
+    Stats->LastUs = Usec;
+    Stats->TotalUs += Usec;
+    Stats->Count++;
+    if (Usec > Stats->MaxUs)
+    {
+        Stats->MaxUs = Usec;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fetch Size raw fix bytes over the given path and time the          */
+/*         transfer. Called from the main, reader and burst tasks, so the     */
+/*         running statistics are only touched under StatsMutex.              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Dev_Fetch(uint8 Path, uint8 *Raw, uint16 Size)
+{
+    GPS_APP_DevData_t *Dev = &GPS_APP_Data.Dev;
+    uint32             Usec;
+    int32              status;
+
+    if (Dev->Fd < 0)
+    {
+        Path = GPS_APP_READ_PATH_RAW;
+    }
+
+    status = GPS_APP_Dev_Transfer(Path, Raw, Size, &Usec);
+    if (status == CFE_SUCCESS)
+    {
+        OS_MutSemTake(Dev->StatsMutex);
+        GPS_APP_Dev_Accumulate(&Dev->Stats[Path], Usec);
+        OS_MutSemGive(Dev->StatsMutex);
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Copy out the running statistics of every read path                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Dev_GetStats(GPS_APP_ReadPathStats_t Stats[GPS_APP_READ_PATH_COUNT])
+{
+    OS_MutSemTake(GPS_APP_Data.Dev.StatsMutex);
+    memcpy(Stats, GPS_APP_Data.Dev.Stats, sizeof(GPS_APP_Data.Dev.Stats));
+    OS_MutSemGive(GPS_APP_Data.Dev.StatsMutex);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Mean transfer time of a read path                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 GPS_APP_Dev_AvgUs(const GPS_APP_ReadPathStats_t *Stats)
+{
+    return (Stats->Count == 0) ? 0 : (uint32)(Stats->TotalUs / Stats->Count);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS select read path command                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_SetReadPath(const GPS_APP_SetReadPathCmd_t *Msg)
+{
+    uint8 Path = Msg->Payload.Path;
+
+    if (Path >= GPS_APP_READ_PATH_COUNT || (Path == GPS_APP_READ_PATH_DEVICE && GPS_APP_Data.Dev.Fd < 0))
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_GENUC_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: read path %u not available",
+                          (unsigned int)Path);
+        return CFE_SUCCESS;
+    }
+
+    GPS_APP_Data.Dev.Path = Path;
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_DEV_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: reading fixes through %s",
+                      (Path == GPS_APP_READ_PATH_DEVICE) ? genuC_path : bus_path);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS read benchmark command, hands the run to the benchmark task            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_ReadBench(const GPS_APP_ReadBenchCmd_t *Msg)
+{
+    GPS_APP_DevData_t *Dev   = &GPS_APP_Data.Dev;
+    uint32             Count = Msg->Payload.Count;
+
+    if (Count == 0 || Count > GPS_APP_READ_BENCH_MAX)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_GENUC_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: read benchmark count %u not in 1..%u",
+                          (unsigned int)Count, (unsigned int)GPS_APP_READ_BENCH_MAX);
+        return CFE_SUCCESS;
+    }
+
+    if (__atomic_load_n(&Dev->BenchBusy, __ATOMIC_ACQUIRE))
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_GENUC_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: read benchmark already running");
+        return CFE_SUCCESS;
+    }
+
+    Dev->BenchCount = Count;
+    __atomic_store_n(&Dev->BenchBusy, true, __ATOMIC_RELEASE);
+    OS_BinSemGive(Dev->BenchSem);
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_DEV_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: read benchmark started, %u fixes",
+                      (unsigned int)Count);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Read the same number of fixes over each available path and report  */
+/*         the mean and worst per-fix time of both. The raw path costs an     */
+/*         open, an ioctl, a close and a heap round trip per fix, the device  */
+/*         path a single read. The benchmark keeps its own statistics, so     */
+/*         the running ones the other tasks update are left alone. Runs in    */
+/*         the benchmark task.                                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Dev_RunBench(uint32 Count)
+{
+    GPS_APP_ReadPathStats_t Stats[GPS_APP_READ_PATH_COUNT];
+    uint8                   Raw[GPS_APP_SAMPLE_BYTES];
+    uint32                  Errors = 0;
+    uint32                  Usec;
+    uint32                  i;
+    uint8                   Path;
+
+    memset(Stats, 0, sizeof(Stats));
+
+    for (Path = 0; Path < GPS_APP_READ_PATH_COUNT; Path++)
+    {
+        if (Path == GPS_APP_READ_PATH_DEVICE && GPS_APP_Data.Dev.Fd < 0)
+        {
+            continue;
+        }
+
+        for (i = 0; i < Count && GPS_APP_Data.RunStatus == CFE_ES_RunStatus_APP_RUN; i++)
+        {
+            if (GPS_APP_Dev_Transfer(Path, Raw, sizeof(Raw), &Usec) == CFE_SUCCESS)
+            {
+                GPS_APP_Dev_Accumulate(&Stats[Path], Usec);
+            }
+            else
+            {
+                Errors++;
+            }
+        }
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_DEV_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: read benchmark, %u fixes: raw avg %u max %u us, device avg %u max %u us, %u errors",
+                      (unsigned int)Count, (unsigned int)GPS_APP_Dev_AvgUs(&Stats[GPS_APP_READ_PATH_RAW]),
+                      (unsigned int)Stats[GPS_APP_READ_PATH_RAW].MaxUs,
+                      (unsigned int)GPS_APP_Dev_AvgUs(&Stats[GPS_APP_READ_PATH_DEVICE]),
+                      (unsigned int)Stats[GPS_APP_READ_PATH_DEVICE].MaxUs, (unsigned int)Errors);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Benchmark child task, runs one benchmark per release                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Dev_BenchTask(void)
+{
+    GPS_APP_DevData_t *Dev = &GPS_APP_Data.Dev;
+
+    while (OS_BinSemTake(Dev->BenchSem) == OS_SUCCESS)
+    {
+        GPS_APP_Dev_RunBench(Dev->BenchCount);
+        __atomic_store_n(&Dev->BenchBusy, false, __ATOMIC_RELEASE);
+
+        if (GPS_APP_Data.RunStatus != CFE_ES_RunStatus_APP_RUN)
+        {
+            break;
+        }
+    }
+
+    CFE_ES_ExitChildTask();
+}
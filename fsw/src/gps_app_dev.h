@@ -0,0 +1,75 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Fix read paths for the GPS App
+ *
+ * A fix can be fetched two ways: the raw path opens the I2C bus and issues an
+ * I2C_RDWR ioctl for every fix, while the device path does a single read() on
+ * the registered genuC device, which the app registers and opens once at
+ * startup and closes and removes on exit. Each path keeps its own timing so
+ * they can be compared on the target. The benchmark command runs in its own
+ * child task, since thousands of back to back transfers would hold up the
+ * command pipe for seconds.
+ */
+
+#ifndef GPS_APP_DEV_H
+#define GPS_APP_DEV_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+
+typedef struct
+{
+    uint32 Count;
+    uint32 LastUs;
+    uint32 MaxUs;
+    uint64 TotalUs;
+} GPS_APP_ReadPathStats_t;
+
+typedef struct
+{
+    int                     Fd; /* genuC device, -1 if it could not be opened */
+    uint8                   Path;
+    osal_id_t               StatsMutex;
+    GPS_APP_ReadPathStats_t Stats[GPS_APP_READ_PATH_COUNT]; /* Under StatsMutex, fetches run in several tasks */
+    uint32                  BusUs; /* Bus time of every transfer since last taken, updated atomically */
+
+    /*
+    ** Read benchmark, Count is set by the command before the task is released
+    */
+    CFE_ES_TaskId_t BenchTaskId;
+    osal_id_t       BenchSem;
+    uint32          BenchCount;
+    bool            BenchBusy;
+} GPS_APP_DevData_t;
+
+int32  GPS_APP_Dev_Init(void);
+void   GPS_APP_Dev_Close(void);
+int32  GPS_APP_Dev_Fetch(uint8 Path, uint8 *Raw, uint16 Size);
+void   GPS_APP_Dev_GetStats(GPS_APP_ReadPathStats_t Stats[GPS_APP_READ_PATH_COUNT]);
+uint32 GPS_APP_Dev_AvgUs(const GPS_APP_ReadPathStats_t *Stats);
+void   GPS_APP_Dev_AccountBus(uint32 Usec);
+uint32 GPS_APP_Dev_TakeBusUs(void);
+int32  GPS_APP_SetReadPath(const GPS_APP_SetReadPathCmd_t *Msg);
+int32  GPS_APP_ReadBench(const GPS_APP_ReadBenchCmd_t *Msg);
+void   GPS_APP_Dev_BenchTask(void);
+
+#endif /* GPS_APP_DEV_H */
@@ -0,0 +1,93 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Diagnostics for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Initialize the diagnostics packet                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Diag_Init(void)
+{
+    memset(&GPS_APP_Data.Diag, 0, sizeof(GPS_APP_Data.Diag));
+
+    CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_Data.DiagTlm.TelemetryHeader), CFE_SB_ValueToMsgId(GPS_APP_DIAG_TLM_MID),
+                 sizeof(GPS_APP_Data.DiagTlm));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Count a failed fetch and report it. Called from the main and the   */
+/*         reader task, so the count is atomic; the event is rate limited by  */
+/*         its EVS filter.                                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Diag_FetchFailed(uint8 Path)
+{
+    uC_error_stats Errors;
+    uint32         Failures;
+
+    Failures = __atomic_add_fetch(&GPS_APP_Data.Diag.FetchFailures, 1, __ATOMIC_RELAXED);
+
+    uC_get_error_stats(&Errors);
+
+    CFE_EVS_SendEvent(GPS_APP_DRIVER_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "GPS: fetch failed on %s path (%u failures, last driver error kind %u errno %d)",
+                      (Path == GPS_APP_READ_PATH_DEVICE) ? "device" : "raw", (unsigned int)Failures,
+                      (unsigned int)Errors.last_kind, Errors.last_errno);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Send the diagnostics packet                                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Diag_Report(void)
+{
+    GPS_APP_DiagTlm_Payload_t *Payload = &GPS_APP_Data.DiagTlm.Payload;
+    uC_error_stats             Errors;
+
+    uC_get_error_stats(&Errors);
+
+    Payload->DrvOpenErrors     = Errors.count[UC_ERR_OPEN];
+    Payload->DrvTransferErrors = Errors.count[UC_ERR_TRANSFER];
+    Payload->DrvAllocErrors    = Errors.count[UC_ERR_ALLOC];
+    Payload->DrvLastErrno      = Errors.last_errno;
+    Payload->DrvLastKind       = Errors.last_kind;
+    Payload->FetchFailures     = __atomic_load_n(&GPS_APP_Data.Diag.FetchFailures, __ATOMIC_RELAXED);
+    Payload->DeadlineOverruns  = GPS_APP_Data.Load.Overruns;
+
+    GPS_APP_Load_TopOffenders(Payload->Top, GPS_APP_DEADLINE_TOP);
+
+    Payload->StreamEncodeUs = GPS_APP_Data.Stream.EncodeUs;
+    memcpy(Payload->Stream, GPS_APP_Data.Stream.Stats, sizeof(Payload->Stream));
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.DiagTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.DiagTlm.TelemetryHeader), true);
+}
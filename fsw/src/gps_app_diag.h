@@ -0,0 +1,49 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Diagnostics for the GPS App
+ *
+ * The uC driver counts its failures and keeps the last errno instead of
+ * printing them. This module reads those counters into the diagnostics
+ * packet, sent with housekeeping, and raises an event for a failed fetch.
+ * That event is filtered at registration, so an error storm costs an EVS
+ * filter check per failure rather than a console write. The packet also
+ * carries the handler deadline overruns counted by the load accounting and
+ * the MIDs that overran most, and the packet counts and packing times of the
+ * output streams.
+ */
+
+#ifndef GPS_APP_DIAG_H
+#define GPS_APP_DIAG_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+
+typedef struct
+{
+    uint32 FetchFailures; /* Failed fetches over either path, updated atomically */
+} GPS_APP_DiagData_t;
+
+void GPS_APP_Diag_Init(void);
+void GPS_APP_Diag_FetchFailed(uint8 Path);
+void GPS_APP_Diag_Report(void);
+
+#endif /* GPS_APP_DIAG_H */
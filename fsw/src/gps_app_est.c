@@ -0,0 +1,258 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Position/velocity estimator for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/*
+** Measurement variance per axis, East and North share the horizontal sigma
+*/
+static const double GPS_APP_Est_MeasVar[GPS_APP_EST_AXES] = {
+    GPS_APP_EST_HORIZ_SIGMA_M * GPS_APP_EST_HORIZ_SIGMA_M,
+    GPS_APP_EST_HORIZ_SIGMA_M * GPS_APP_EST_HORIZ_SIGMA_M,
+    GPS_APP_EST_VERT_SIGMA_M * GPS_APP_EST_VERT_SIGMA_M,
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Initialize the estimator and its packet                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Est_Init(void)
+{
+    memset(&GPS_APP_Data.Est, 0, sizeof(GPS_APP_Data.Est));
+
+    CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_Data.EstTlm.TelemetryHeader), CFE_SB_ValueToMsgId(GPS_APP_EST_TLM_MID),
+                 sizeof(GPS_APP_Data.EstTlm));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Propagate every axis by Dt seconds under the constant-velocity     */
+/*         model, with white acceleration noise of GPS_APP_EST_ACCEL_PSD.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Est_Predict(GPS_APP_EstData_t *Est, double Dt)
+{
+    GPS_APP_EstAxis_t *A;
+    double             Q   = GPS_APP_EST_ACCEL_PSD;
+    double             Dt2 = Dt * Dt;
+    uint32             i;
+
+    for (i = 0; i < GPS_APP_EST_AXES; i++)
+    {
+        A = &Est->Axis[i];
+
+        A->Pos += A->Vel * Dt;
+        A->P00 += Dt * (2.0 * A->P01 + Dt * A->P11) + Q * Dt2 * Dt / 3.0;
+        A->P01 += Dt * A->P11 + Q * Dt2 / 2.0;
+        A->P11 += Q * Dt;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Propagate the state from StateTime to Now, never backwards                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Est_PropagateTo(GPS_APP_EstData_t *Est, OS_time_t Now)
+{
+    uint32 Usec = GPS_APP_DeltaUsec(Est->StateTime, Now);
+
+    if (Usec > 0)
+    {
+        GPS_APP_Est_Predict(Est, Usec / 1.0e6);
+        Est->StateTime = Now;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Restart the filter at a fix, with the origin of the local frame on it      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Est_Reset(GPS_APP_EstData_t *Est, const GPS_APP_Sample_t *Sample)
+{
+    uint32 i;
+
+    GPS_APP_Geo_SetReference(&Est->Origin, Sample->latitude, Sample->longitude, Sample->altitude);
+
+    for (i = 0; i < GPS_APP_EST_AXES; i++)
+    {
+        Est->Axis[i].Pos = 0.0;
+        Est->Axis[i].Vel = 0.0;
+        Est->Axis[i].P00 = GPS_APP_Est_MeasVar[i];
+        Est->Axis[i].P01 = 0.0;
+        Est->Axis[i].P11 = GPS_APP_EST_INIT_VEL_SIGMA * GPS_APP_EST_INIT_VEL_SIGMA;
+    }
+
+    Est->StateTime = Sample->AcquiredTime;
+    Est->Valid     = true;
+    Est->Resets++;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Apply a committed fix as a position measurement. A fix older than  */
+/*         the state (a pipelined read published after a tick) is applied at  */
+/*         the state time.                                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Est_Update(const GPS_APP_Sample_t *Sample)
+{
+    GPS_APP_EstData_t *Est = &GPS_APP_Data.Est;
+    GPS_APP_EstAxis_t *A;
+    OS_time_t          StartTime;
+    OS_time_t          EndTime;
+    double             Lat = Sample->latitude;
+    double             Lon = Sample->longitude;
+    double             Alt = Sample->altitude;
+    double             X, Y, Z;
+    double             Meas[GPS_APP_EST_AXES];
+    double             S, K0, K1, Innov;
+    uint32             i;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    if (!Est->Valid || GPS_APP_DeltaUsec(Est->FixTime, Sample->AcquiredTime) / 1000 > GPS_APP_EST_MAX_GAP_MS)
+    {
+        GPS_APP_Est_Reset(Est, Sample);
+    }
+    else
+    {
+        GPS_APP_Est_PropagateTo(Est, Sample->AcquiredTime);
+    }
+    Est->FixTime = Sample->AcquiredTime;
+
+    GPS_APP_Geo_LlaToEcef(&Lat, &Lon, &Alt, &X, &Y, &Z, 1);
+    GPS_APP_Geo_EcefToEnu(&Est->Origin, &X, &Y, &Z, &Meas[GPS_APP_EST_EAST], &Meas[GPS_APP_EST_NORTH],
+                          &Meas[GPS_APP_EST_UP], 1);
+
+    /*
+    ** Keep the frame near the vehicle. Moving the origin onto the fix shifts
+    ** the positions; the velocities are kept, the frame rotation over
+    ** GPS_APP_EST_REORIGIN_M is negligible against the noise.
+    */
+    if (Meas[GPS_APP_EST_EAST] * Meas[GPS_APP_EST_EAST] + Meas[GPS_APP_EST_NORTH] * Meas[GPS_APP_EST_NORTH] >
+        GPS_APP_EST_REORIGIN_M * GPS_APP_EST_REORIGIN_M)
+    {
+        GPS_APP_Geo_SetReference(&Est->Origin, Lat, Lon, Alt);
+        for (i = 0; i < GPS_APP_EST_AXES; i++)
+        {
+            Est->Axis[i].Pos -= Meas[i];
+            Meas[i] = 0.0;
+        }
+        Est->Resets++;
+    }
+
+    for (i = 0; i < GPS_APP_EST_AXES; i++)
+    {
+        A = &Est->Axis[i];
+
+        S     = A->P00 + GPS_APP_Est_MeasVar[i];
+        K0    = A->P00 / S;
+        K1    = A->P01 / S;
+        Innov = Meas[i] - A->Pos;
+
+        A->Pos += K0 * Innov;
+        A->Vel += K1 * Innov;
+        A->P11 -= K1 * A->P01;
+        A->P01 -= K0 * A->P01;
+        A->P00 -= K0 * A->P00;
+    }
+
+    Est->Fixes++;
+
+    CFE_PSP_GetTime(&EndTime);
+    Est->UpdateUs = GPS_APP_DeltaUsec(StartTime, EndTime);
+    if (Est->UpdateUs > Est->UpdateMaxUs)
+    {
+        Est->UpdateMaxUs = Est->UpdateUs;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Estimator tick: propagate to now and publish the estimate. The     */
+/*         whole tick is timed, conversion and send included, for the cycle   */
+/*         budget.                                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Est_Tick(const CFE_MSG_CommandHeader_t *Msg)
+{
+    GPS_APP_EstData_t *       Est     = &GPS_APP_Data.Est;
+    GPS_APP_EstTlm_Payload_t *Payload = &GPS_APP_Data.EstTlm.Payload;
+    OS_time_t                 StartTime;
+    OS_time_t                 EndTime;
+    double                    X, Y, Z;
+    uint32                    i;
+
+    if (!Est->Valid)
+    {
+        return CFE_SUCCESS;
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+    CFE_ES_PerfLogEntry(GPS_APP_EST_PERF_ID);
+
+    GPS_APP_Est_PropagateTo(Est, StartTime);
+
+    GPS_APP_Geo_EnuToEcef(&Est->Origin, &Est->Axis[GPS_APP_EST_EAST].Pos, &Est->Axis[GPS_APP_EST_NORTH].Pos,
+                          &Est->Axis[GPS_APP_EST_UP].Pos, &X, &Y, &Z, 1);
+    GPS_APP_Geo_EcefToLla(&X, &Y, &Z, &Payload->Latitude, &Payload->Longitude, &Payload->Altitude, 1);
+
+    for (i = 0; i < GPS_APP_EST_AXES; i++)
+    {
+        Payload->Pos[i]       = Est->Axis[i].Pos;
+        Payload->Vel[i]       = Est->Axis[i].Vel;
+        Payload->PosVar[i]    = Est->Axis[i].P00;
+        Payload->PosVelCov[i] = Est->Axis[i].P01;
+        Payload->VelVar[i]    = Est->Axis[i].P11;
+    }
+    Payload->OriginLat = Est->Origin.Lat;
+    Payload->OriginLon = Est->Origin.Lon;
+    Payload->OriginAlt = Est->Origin.Alt;
+    Payload->FixAgeMs  = GPS_APP_DeltaUsec(Est->FixTime, StartTime) / 1000;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.EstTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.EstTlm.TelemetryHeader), true);
+
+    Est->Ticks++;
+
+    CFE_ES_PerfLogExit(GPS_APP_EST_PERF_ID);
+    CFE_PSP_GetTime(&EndTime);
+
+    Est->TickUs = GPS_APP_DeltaUsec(StartTime, EndTime);
+    if (Est->TickUs > Est->TickMaxUs)
+    {
+        Est->TickMaxUs = Est->TickUs;
+    }
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Position/velocity estimator for the GPS App
+ *
+ * A constant-velocity Kalman filter, run independently on each axis of a
+ * local East-North-Up frame centred near the vehicle, so every matrix is a
+ * fixed 2x2 held in three scalars and nothing is allocated. Each committed
+ * fix is a position measurement. Each GPS_APP_EST_TICK_MID wakeup, sent by
+ * the scheduler at the control loop rate, propagates the state to the
+ * current time and publishes position, velocity and covariance.
+ */
+
+#ifndef GPS_APP_EST_H
+#define GPS_APP_EST_H
+
+#include "cfe.h"
+#include "gps_app_geo.h"
+#include "gps_app_msg.h"
+#include "gps_app_sample.h"
+
+/*
+** State and covariance of one axis. P is symmetric, P10 == P01.
+*/
+typedef struct
+{
+    double Pos;
+    double Vel;
+    double P00;
+    double P01;
+    double P11;
+} GPS_APP_EstAxis_t;
+
+typedef struct
+{
+    bool              Valid;
+    GPS_APP_GeoRef_t  Origin;
+    GPS_APP_EstAxis_t Axis[GPS_APP_EST_AXES];
+    OS_time_t         StateTime; /* Time the state was last propagated to */
+    OS_time_t         FixTime;   /* Time of the last fix applied */
+
+    uint32 Ticks;
+    uint32 Fixes;
+    uint32 Resets;     /* Filter restarts after a long gap, or origin moves */
+    uint32 TickUs;     /* Propagate and publish, last and worst */
+    uint32 TickMaxUs;
+    uint32 UpdateUs;   /* Fix update, last and worst */
+    uint32 UpdateMaxUs;
+} GPS_APP_EstData_t;
+
+void  GPS_APP_Est_Init(void);
+void  GPS_APP_Est_Update(const GPS_APP_Sample_t *Sample);
+int32 GPS_APP_Est_Tick(const CFE_MSG_CommandHeader_t *Msg);
+
+#endif /* GPS_APP_EST_H */
@@ -35,5 +35,27 @@
 #define GPS_APP_PIPE_ERR_EID          7
 #define GPS_APP_GENUC_ERR_EID         8
 #define GPS_APP_DEV_INF_EID           9
+#define GPS_APP_LOADGEN_INF_EID       10
+#define GPS_APP_LOADGEN_ERR_EID       11
+#define GPS_APP_GEO_INF_EID           12
+#define GPS_APP_GEO_ERR_EID           13
+#define GPS_APP_FENCE_ENTER_EID       14
+#define GPS_APP_FENCE_EXIT_EID        15
+#define GPS_APP_FENCE_ERR_EID         16
+#define GPS_APP_CDS_INF_EID           17
+#define GPS_APP_CDS_ERR_EID           18
+#define GPS_APP_CYCLE_INF_EID         19
+#define GPS_APP_CYCLE_ERR_EID         20
+#define GPS_APP_LOG_INF_EID           21
+#define GPS_APP_LOG_ERR_EID           22
+#define GPS_APP_DRIVER_ERR_EID        23
+#define GPS_APP_STATS_INF_EID         24
+#define GPS_APP_BURST_INF_EID         25
+#define GPS_APP_BURST_ERR_EID         26
+#define GPS_APP_DEADLINE_INF_EID      27
+#define GPS_APP_DEADLINE_ERR_EID      28
+#define GPS_APP_STREAM_INF_EID        29
+#define GPS_APP_STREAM_ERR_EID        30
+#define GPS_APP_POLL_INF_EID          31
 
 #endif /* GPS_APP_EVENTS_H */
@@ -0,0 +1,424 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Geofence engine for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+#define GPS_APP_FENCE_DEG2RAD      (M_PI / 180.0)
+#define GPS_APP_FENCE_M_PER_DEG    (GPS_APP_GEO_A * GPS_APP_FENCE_DEG2RAD)
+#define GPS_APP_FENCE_LON_CELLS    ((int32)(360.0 / GPS_APP_FENCE_CELL_DEG + 0.5))
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Grid cell of a latitude/longitude and its hash bucket                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_Fence_Cell(double Deg)
+{
+    return (int32)floor(Deg / GPS_APP_FENCE_CELL_DEG);
+}
+
+static int32 GPS_APP_Fence_WrapLonCell(int32 LonCell)
+{
+    LonCell %= GPS_APP_FENCE_LON_CELLS;
+
+    return (LonCell < 0) ? LonCell + GPS_APP_FENCE_LON_CELLS : LonCell;
+}
+
+static uint32 GPS_APP_Fence_Hash(int32 LatCell, int32 LonCell)
+{
+    return (((uint32)LatCell * 73856093U) ^ ((uint32)LonCell * 19349663U)) & (GPS_APP_FENCE_GRID_BUCKETS - 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Longitude difference taken the shorter way around                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static double GPS_APP_Fence_WrapLon(double DLon)
+{
+    if (DLon > 180.0)
+    {
+        DLon -= 360.0;
+    }
+    else if (DLon < -180.0)
+    {
+        DLon += 360.0;
+    }
+
+    return DLon;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* True if Lon, or the same meridian a turn away, is inside a region's box    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Fence_InLonBox(uint32 r, double Lon)
+{
+    const GPS_APP_FenceData_t *Fence = &GPS_APP_Data.Fence;
+
+    return (Lon >= Fence->MinLon[r] && Lon <= Fence->MaxLon[r]) ||
+           (Lon + 360.0 >= Fence->MinLon[r] && Lon + 360.0 <= Fence->MaxLon[r]) ||
+           (Lon - 360.0 >= Fence->MinLon[r] && Lon - 360.0 <= Fence->MaxLon[r]);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Exact inside tests                                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Fence_InCircle(const GPS_APP_FenceRegion_t *Region, double Lat, double Lon)
+{
+    double DLon  = GPS_APP_Fence_WrapLon(Lon - Region->CenterLon);
+    double North = (Lat - Region->CenterLat) * GPS_APP_FENCE_M_PER_DEG;
+    double East  = DLon * GPS_APP_FENCE_M_PER_DEG * cos(Region->CenterLat * GPS_APP_FENCE_DEG2RAD);
+
+    return (North * North + East * East) <= (Region->RadiusM * Region->RadiusM);
+}
+
+static bool GPS_APP_Fence_InPolygon(const GPS_APP_FenceRegion_t *Region, double Lat, double Lon)
+{
+    bool   Inside = false;
+    double Xi;
+    double Xj;
+    uint32 i;
+    uint32 j;
+
+    /*
+    ** Ray casting along the longitude axis, with the vertex longitudes taken
+    ** relative to the fix so an edge across the antimeridian stays short
+    */
+    for (i = 0, j = Region->NumVertices - 1; i < Region->NumVertices; j = i++)
+    {
+        Xi = GPS_APP_Fence_WrapLon(Region->Lon[i] - Lon);
+        Xj = GPS_APP_Fence_WrapLon(Region->Lon[j] - Lon);
+
+        if (((Region->Lat[i] > Lat) != (Region->Lat[j] > Lat)) &&
+            (0.0 < (Xj - Xi) * (Lat - Region->Lat[i]) / (Region->Lat[j] - Region->Lat[i]) + Xi))
+        {
+            Inside = !Inside;
+        }
+    }
+
+    return Inside;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuild the bounding boxes and the hashed grid from the table.     */
+/*         Hash collisions only add candidates, never lose them. A box that   */
+/*         runs past +/-180 degrees fills the wrapped cells on the far side.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Fence_BuildIndex(const GPS_APP_FenceTbl_t *Tbl)
+{
+    GPS_APP_FenceData_t *        Fence = &GPS_APP_Data.Fence;
+    const GPS_APP_FenceRegion_t *Region;
+    double                       HalfLat;
+    double                       HalfLon;
+    double                       Lon;
+    int32                        LatCell;
+    int32                        LonCell;
+    int32                        LatCell0;
+    int32                        LonCell0;
+    int32                        LatCell1;
+    int32                        LonCell1;
+    uint32                       r;
+    uint32                       v;
+
+    memset(Fence->Bucket, 0, sizeof(Fence->Bucket));
+    Fence->AlwaysMask = 0;
+
+    for (r = 0; r < GPS_APP_FENCE_MAX_REGIONS; r++)
+    {
+        Region = &Tbl->Region[r];
+
+        if (Region->Type == GPS_APP_FENCE_CIRCLE)
+        {
+            HalfLat = Region->RadiusM / GPS_APP_FENCE_M_PER_DEG;
+            HalfLon = HalfLat / fmax(cos(Region->CenterLat * GPS_APP_FENCE_DEG2RAD), 0.01);
+
+            Fence->MinLat[r] = Region->CenterLat - HalfLat;
+            Fence->MaxLat[r] = Region->CenterLat + HalfLat;
+            Fence->MinLon[r] = Region->CenterLon - HalfLon;
+            Fence->MaxLon[r] = Region->CenterLon + HalfLon;
+        }
+        else if (Region->Type == GPS_APP_FENCE_POLYGON)
+        {
+            /*
+            ** Vertices are unwrapped from the first one, each edge taking
+            ** the shorter way around
+            */
+            Lon              = Region->Lon[0];
+            Fence->MinLat[r] = Fence->MaxLat[r] = Region->Lat[0];
+            Fence->MinLon[r] = Fence->MaxLon[r] = Lon;
+            for (v = 1; v < Region->NumVertices; v++)
+            {
+                Lon += GPS_APP_Fence_WrapLon(Region->Lon[v] - Region->Lon[v - 1]);
+                Fence->MinLat[r] = fmin(Fence->MinLat[r], Region->Lat[v]);
+                Fence->MaxLat[r] = fmax(Fence->MaxLat[r], Region->Lat[v]);
+                Fence->MinLon[r] = fmin(Fence->MinLon[r], Lon);
+                Fence->MaxLon[r] = fmax(Fence->MaxLon[r], Lon);
+            }
+        }
+        else
+        {
+            continue;
+        }
+
+        /*
+        ** A box around a pole, or one a turn wide, covers every longitude
+        */
+        if (Fence->MaxLon[r] - Fence->MinLon[r] >= 360.0 || Fence->MinLat[r] <= -90.0 || Fence->MaxLat[r] >= 90.0)
+        {
+            Fence->MinLon[r] = -180.0;
+            Fence->MaxLon[r] = 180.0;
+        }
+
+        LatCell0 = GPS_APP_Fence_Cell(Fence->MinLat[r]);
+        LatCell1 = GPS_APP_Fence_Cell(Fence->MaxLat[r]);
+        LonCell0 = GPS_APP_Fence_Cell(Fence->MinLon[r]);
+        LonCell1 = GPS_APP_Fence_Cell(Fence->MaxLon[r]);
+
+        if ((uint64)(LatCell1 - LatCell0 + 1) * (uint64)(LonCell1 - LonCell0 + 1) > GPS_APP_FENCE_MAX_REGION_CELLS)
+        {
+            Fence->AlwaysMask |= (1U << r);
+            continue;
+        }
+
+        for (LatCell = LatCell0; LatCell <= LatCell1; LatCell++)
+        {
+            for (LonCell = LonCell0; LonCell <= LonCell1; LonCell++)
+            {
+                Fence->Bucket[GPS_APP_Fence_Hash(LatCell, GPS_APP_Fence_WrapLonCell(LonCell))] |= (1U << r);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Register and load the geofence table                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Fence_Init(void)
+{
+    int32 status;
+
+    memset(&GPS_APP_Data.Fence, 0, sizeof(GPS_APP_Data.Fence));
+
+    status = CFE_TBL_Register(&GPS_APP_Data.Fence.TblHandle, GPS_APP_FENCE_TBL_NAME, sizeof(GPS_APP_FenceTbl_t),
+                              CFE_TBL_OPT_DEFAULT, GPS_APP_Fence_ValidateTbl);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error Registering Fence Table, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    /*
+    ** A missing table only disables the geofence, the index is built on
+    ** the first fix after a good load
+    */
+    status = CFE_TBL_Load(GPS_APP_Data.Fence.TblHandle, CFE_TBL_SRC_FILE, GPS_APP_FENCE_TBL_FILE);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(GPS_APP_FENCE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: error loading fence table %s, RC = 0x%08lX", GPS_APP_FENCE_TBL_FILE,
+                          (unsigned long)status);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* True for a finite latitude/longitude in range                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Fence_PointOk(double Lat, double Lon)
+{
+    return isfinite(Lat) && isfinite(Lon) && Lat >= -90.0 && Lat <= 90.0 && Lon >= -180.0 && Lon <= 180.0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Validate a geofence table image                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Fence_ValidateTbl(void *TblData)
+{
+    const GPS_APP_FenceTbl_t *   Tbl = TblData;
+    const GPS_APP_FenceRegion_t *Region;
+    bool                         Valid;
+    uint32                       r;
+    uint32                       v;
+
+    for (r = 0; r < GPS_APP_FENCE_MAX_REGIONS; r++)
+    {
+        Region = &Tbl->Region[r];
+
+        switch (Region->Type)
+        {
+            case GPS_APP_FENCE_UNUSED:
+                Valid = true;
+                break;
+
+            case GPS_APP_FENCE_CIRCLE:
+                Valid = (isfinite(Region->RadiusM) && Region->RadiusM > 0 &&
+                         Region->RadiusM <= GPS_APP_FENCE_MAX_RADIUS_M &&
+                         GPS_APP_Fence_PointOk(Region->CenterLat, Region->CenterLon));
+                break;
+
+            case GPS_APP_FENCE_POLYGON:
+                Valid = (Region->NumVertices >= 3 && Region->NumVertices <= GPS_APP_FENCE_MAX_VERTICES);
+                for (v = 0; Valid && v < Region->NumVertices; v++)
+                {
+                    Valid = GPS_APP_Fence_PointOk(Region->Lat[v], Region->Lon[v]);
+                }
+                break;
+
+            default:
+                Valid = false;
+                break;
+        }
+
+        if (!Valid)
+        {
+            CFE_EVS_SendEvent(GPS_APP_FENCE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "GPS: fence table region %u (id %u) invalid, type = %u", (unsigned int)r,
+                              (unsigned int)Region->RegionId, (unsigned int)Region->Type);
+            return CFE_STATUS_VALIDATION_FAILURE;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Give table services a chance to validate and apply pending loads           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Fence_Manage(void)
+{
+    CFE_TBL_Manage(GPS_APP_Data.Fence.TblHandle);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Test a new fix against the regions in its grid bucket and send an  */
+/*         event for every region entered or left since the last fix.         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Fence_Evaluate(double Lat, double Lon)
+{
+    GPS_APP_FenceData_t *        Fence  = &GPS_APP_Data.Fence;
+    GPS_APP_FenceTbl_t *         TblPtr = NULL;
+    const GPS_APP_FenceRegion_t *Region;
+    OS_time_t                    StartTime;
+    OS_time_t                    EndTime;
+    uint32                       Candidates;
+    uint32                       NewInside = 0;
+    uint32                       Changed;
+    uint32                       r;
+    int32                        status;
+
+    CFE_PSP_GetTime(&StartTime);
+    CFE_ES_PerfLogEntry(GPS_APP_FENCE_PERF_ID);
+
+    status = CFE_TBL_GetAddress((void **)&TblPtr, Fence->TblHandle);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        GPS_APP_Fence_BuildIndex(TblPtr);
+        Fence->InsideMask = 0;
+    }
+    else if (status != CFE_SUCCESS)
+    {
+        CFE_ES_PerfLogExit(GPS_APP_FENCE_PERF_ID);
+        return;
+    }
+
+    Candidates =
+        Fence->Bucket[GPS_APP_Fence_Hash(GPS_APP_Fence_Cell(Lat), GPS_APP_Fence_WrapLonCell(GPS_APP_Fence_Cell(Lon)))] |
+        Fence->AlwaysMask;
+    Fence->Candidates = 0;
+
+    while (Candidates != 0)
+    {
+        r = __builtin_ctz(Candidates);
+        Candidates &= Candidates - 1;
+
+        if (Lat < Fence->MinLat[r] || Lat > Fence->MaxLat[r] || !GPS_APP_Fence_InLonBox(r, Lon))
+        {
+            continue;
+        }
+
+        Fence->Candidates++;
+        Region = &TblPtr->Region[r];
+        if ((Region->Type == GPS_APP_FENCE_CIRCLE) ? GPS_APP_Fence_InCircle(Region, Lat, Lon)
+                                                   : GPS_APP_Fence_InPolygon(Region, Lat, Lon))
+        {
+            NewInside |= (1U << r);
+        }
+    }
+
+    Changed = NewInside ^ Fence->InsideMask;
+    while (Changed != 0)
+    {
+        r = __builtin_ctz(Changed);
+        Changed &= Changed - 1;
+
+        if (NewInside & (1U << r))
+        {
+            CFE_EVS_SendEvent(GPS_APP_FENCE_ENTER_EID, CFE_EVS_EventType_INFORMATION,
+                              "GPS: entered region %u at lat = %f, lon = %f", (unsigned int)TblPtr->Region[r].RegionId,
+                              Lat, Lon);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(GPS_APP_FENCE_EXIT_EID, CFE_EVS_EventType_INFORMATION,
+                              "GPS: left region %u at lat = %f, lon = %f", (unsigned int)TblPtr->Region[r].RegionId,
+                              Lat, Lon);
+        }
+    }
+    Fence->InsideMask = NewInside;
+
+    CFE_TBL_ReleaseAddress(Fence->TblHandle);
+
+    CFE_ES_PerfLogExit(GPS_APP_FENCE_PERF_ID);
+    CFE_PSP_GetTime(&EndTime);
+
+    Fence->EvalTimeUs = GPS_APP_DeltaUsec(StartTime, EndTime);
+    if (Fence->EvalTimeUs > Fence->EvalTimeMaxUs)
+    {
+        Fence->EvalTimeMaxUs = Fence->EvalTimeUs;
+    }
+}
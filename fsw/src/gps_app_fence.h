@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Geofence table definition and engine for the GPS App
+ *
+ * Regions (circles and polygons in latitude/longitude) come from a cFE table.
+ * When the table is loaded each region's bounding box is rasterized onto a
+ * hashed latitude/longitude grid, and each grid bucket keeps a bit mask of the
+ * regions overlapping it. Evaluating a fix hashes its cell and runs the exact
+ * inside test only on the regions in that bucket, so the cost per fix does not
+ * grow with the number of regions in the table. Polygon edges take the shorter
+ * way around in longitude, so circles and polygons may cross the
+ * antimeridian; their bounding boxes then run past +/-180 degrees and the grid
+ * cells wrap.
+ */
+
+#ifndef GPS_APP_FENCE_H
+#define GPS_APP_FENCE_H
+
+#include "cfe.h"
+#include "gps_app_platform_cfg.h"
+
+/*
+** Region types
+*/
+#define GPS_APP_FENCE_UNUSED  0
+#define GPS_APP_FENCE_CIRCLE  1
+#define GPS_APP_FENCE_POLYGON 2
+
+#if GPS_APP_FENCE_MAX_REGIONS > 32
+#error GPS_APP_FENCE_MAX_REGIONS must fit in the 32 bit region masks
+#endif
+
+/*
+** Table definition
+*/
+typedef struct
+{
+    uint8  Type;        /* GPS_APP_FENCE_CIRCLE, _POLYGON or _UNUSED */
+    uint8  NumVertices; /* Polygons only, 3 to GPS_APP_FENCE_MAX_VERTICES */
+    uint16 RegionId;    /* Reported in the enter/exit events */
+    uint8  spare[4];
+    double CenterLat;   /* Circles only, degrees */
+    double CenterLon;
+    double RadiusM;
+    double Lat[GPS_APP_FENCE_MAX_VERTICES]; /* Polygons only, degrees, in order */
+    double Lon[GPS_APP_FENCE_MAX_VERTICES];
+} GPS_APP_FenceRegion_t;
+
+typedef struct
+{
+    GPS_APP_FenceRegion_t Region[GPS_APP_FENCE_MAX_REGIONS];
+} GPS_APP_FenceTbl_t;
+
+/*
+** Engine state
+*/
+typedef struct
+{
+    CFE_TBL_Handle_t TblHandle;
+
+    uint32 Bucket[GPS_APP_FENCE_GRID_BUCKETS]; /* Regions overlapping each hashed cell */
+    uint32 AlwaysMask;                         /* Regions too large to rasterize, always tested */
+    double MinLat[GPS_APP_FENCE_MAX_REGIONS];  /* Bounding boxes, longitudes unwrapped */
+    double MaxLat[GPS_APP_FENCE_MAX_REGIONS];
+    double MinLon[GPS_APP_FENCE_MAX_REGIONS];
+    double MaxLon[GPS_APP_FENCE_MAX_REGIONS];
+
+    uint32 InsideMask;
+    uint32 Candidates;
+    uint32 EvalTimeUs;
+    uint32 EvalTimeMaxUs;
+} GPS_APP_FenceData_t;
+
+int32 GPS_APP_Fence_Init(void);
+int32 GPS_APP_Fence_ValidateTbl(void *TblData);
+void  GPS_APP_Fence_Manage(void);
+void  GPS_APP_Fence_Evaluate(double Lat, double Lon);
+
+#endif /* GPS_APP_FENCE_H */
@@ -0,0 +1,275 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   WGS-84 geodetic conversion kernels for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app.h"
+#include "gps_app_geo.h"
+
+#define GPS_APP_GEO_DEG2RAD (M_PI / 180.0)
+#define GPS_APP_GEO_RAD2DEG (180.0 / M_PI)
+
+/*
+** Second eccentricity squared, used by Bowring's latitude
+*/
+#define GPS_APP_GEO_EP2 \
+    ((GPS_APP_GEO_A * GPS_APP_GEO_A - GPS_APP_GEO_B * GPS_APP_GEO_B) / (GPS_APP_GEO_B * GPS_APP_GEO_B))
+
+/*
+** Self test workspace, static so the benchmark never touches the heap
+*/
+static double GPS_APP_GeoBench[9][GPS_APP_GEO_BENCH_COUNT];
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Set the ENU frame origin                                                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Geo_SetReference(GPS_APP_GeoRef_t *Ref, double Lat, double Lon, double Alt)
+{
+    Ref->Lat    = Lat;
+    Ref->Lon    = Lon;
+    Ref->Alt    = Alt;
+    Ref->SinLat = sin(Lat * GPS_APP_GEO_DEG2RAD);
+    Ref->CosLat = cos(Lat * GPS_APP_GEO_DEG2RAD);
+    Ref->SinLon = sin(Lon * GPS_APP_GEO_DEG2RAD);
+    Ref->CosLon = cos(Lon * GPS_APP_GEO_DEG2RAD);
+
+    GPS_APP_Geo_LlaToEcef(&Lat, &Lon, &Alt, &Ref->X0, &Ref->Y0, &Ref->Z0, 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Geodetic to Earth-centered Earth-fixed                                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Geo_LlaToEcef(const double *restrict Lat, const double *restrict Lon, const double *restrict Alt,
+                           double *restrict X, double *restrict Y, double *restrict Z, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        double SinLat = sin(Lat[i] * GPS_APP_GEO_DEG2RAD);
+        double CosLat = cos(Lat[i] * GPS_APP_GEO_DEG2RAD);
+        double SinLon = sin(Lon[i] * GPS_APP_GEO_DEG2RAD);
+        double CosLon = cos(Lon[i] * GPS_APP_GEO_DEG2RAD);
+        double N      = GPS_APP_GEO_A / sqrt(1.0 - GPS_APP_GEO_E2 * SinLat * SinLat);
+
+        X[i] = (N + Alt[i]) * CosLat * CosLon;
+        Y[i] = (N + Alt[i]) * CosLat * SinLon;
+        Z[i] = (N * (1.0 - GPS_APP_GEO_E2) + Alt[i]) * SinLat;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Earth-centered Earth-fixed to geodetic. Uses Bowring's single      */
+/*         step latitude (nanometers at the surface, ~3 mm at 700 km) and a   */
+/*         height formula that stays well conditioned at the poles, so the    */
+/*         loop needs no branches.                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Geo_EcefToLla(const double *restrict X, const double *restrict Y, const double *restrict Z,
+                           double *restrict Lat, double *restrict Lon, double *restrict Alt, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        double P        = sqrt(X[i] * X[i] + Y[i] * Y[i]);
+        double Theta    = atan2(Z[i] * GPS_APP_GEO_A, P * GPS_APP_GEO_B);
+        double SinTheta = sin(Theta);
+        double CosTheta = cos(Theta);
+        double Phi      = atan2(Z[i] + GPS_APP_GEO_EP2 * GPS_APP_GEO_B * SinTheta * SinTheta * SinTheta,
+                                P - GPS_APP_GEO_E2 * GPS_APP_GEO_A * CosTheta * CosTheta * CosTheta);
+        double SinPhi   = sin(Phi);
+        double CosPhi   = cos(Phi);
+
+        Lat[i] = Phi * GPS_APP_GEO_RAD2DEG;
+        Lon[i] = atan2(Y[i], X[i]) * GPS_APP_GEO_RAD2DEG;
+        Alt[i] = P * CosPhi + Z[i] * SinPhi - GPS_APP_GEO_A * sqrt(1.0 - GPS_APP_GEO_E2 * SinPhi * SinPhi);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Earth-centered Earth-fixed to local East-North-Up                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Geo_EcefToEnu(const GPS_APP_GeoRef_t *Ref, const double *restrict X, const double *restrict Y,
+                           const double *restrict Z, double *restrict E, double *restrict N, double *restrict U,
+                           uint32 Count)
+{
+    const double SinLat = Ref->SinLat;
+    const double CosLat = Ref->CosLat;
+    const double SinLon = Ref->SinLon;
+    const double CosLon = Ref->CosLon;
+    uint32       i;
+
+    for (i = 0; i < Count; i++)
+    {
+        double Dx = X[i] - Ref->X0;
+        double Dy = Y[i] - Ref->Y0;
+        double Dz = Z[i] - Ref->Z0;
+
+        E[i] = -SinLon * Dx + CosLon * Dy;
+        N[i] = -SinLat * CosLon * Dx - SinLat * SinLon * Dy + CosLat * Dz;
+        U[i] = CosLat * CosLon * Dx + CosLat * SinLon * Dy + SinLat * Dz;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Local East-North-Up to Earth-centered Earth-fixed                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Geo_EnuToEcef(const GPS_APP_GeoRef_t *Ref, const double *restrict E, const double *restrict N,
+                           const double *restrict U, double *restrict X, double *restrict Y, double *restrict Z,
+                           uint32 Count)
+{
+    const double SinLat = Ref->SinLat;
+    const double CosLat = Ref->CosLat;
+    const double SinLon = Ref->SinLon;
+    const double CosLon = Ref->CosLon;
+    uint32       i;
+
+    for (i = 0; i < Count; i++)
+    {
+        X[i] = Ref->X0 - SinLon * E[i] - SinLat * CosLon * N[i] + CosLat * CosLon * U[i];
+        Y[i] = Ref->Y0 + CosLon * E[i] - SinLat * SinLon * N[i] + CosLat * SinLon * U[i];
+        Z[i] = Ref->Z0 + CosLat * N[i] + SinLat * U[i];
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Check the kernels against reference points and time them.          */
+/*         Returns CFE_SUCCESS if every check is within tolerance. The        */
+/*         benchmark runs LLA -> ECEF -> ENU -> ECEF -> LLA over a batch and  */
+/*         reports complete round trips per second.                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Geo_SelfTest(double *MaxErrorM, uint32 *FixesPerSec)
+{
+    /*
+    ** Points with exact ECEF coordinates: equator at the prime meridian and
+    ** at 90E, both poles, and 1 km up at the prime meridian
+    */
+    static const double RefLla[5][3]  = {{0, 0, 0}, {0, 90, 0}, {90, 0, 0}, {-90, 0, 0}, {0, 0, 1000}};
+    static const double RefEcef[5][3] = {{GPS_APP_GEO_A, 0, 0},
+                                         {0, GPS_APP_GEO_A, 0},
+                                         {0, 0, GPS_APP_GEO_B},
+                                         {0, 0, -GPS_APP_GEO_B},
+                                         {GPS_APP_GEO_A + 1000, 0, 0}};
+
+    double          (*Bench)[GPS_APP_GEO_BENCH_COUNT] = GPS_APP_GeoBench;
+    GPS_APP_GeoRef_t Ref;
+    OS_time_t        StartTime;
+    OS_time_t        EndTime;
+    double           MaxError = 0;
+    double           Error;
+    double           X, Y, Z, E, N, U, Lat, Lon, Alt;
+    uint32           Usec;
+    uint32           i;
+
+    /*
+    ** Absolute checks against the exact points
+    */
+    for (i = 0; i < 5; i++)
+    {
+        GPS_APP_Geo_LlaToEcef(&RefLla[i][0], &RefLla[i][1], &RefLla[i][2], &X, &Y, &Z, 1);
+        Error = fabs(X - RefEcef[i][0]) + fabs(Y - RefEcef[i][1]) + fabs(Z - RefEcef[i][2]);
+        MaxError = fmax(MaxError, Error);
+    }
+
+    /*
+    ** A point straight above the origin is pure Up, and one on the equator
+    ** 90 degrees east is 1 radius East and 1 radius Down
+    */
+    GPS_APP_Geo_SetReference(&Ref, 0, 0, 0);
+    X = GPS_APP_GEO_A + 1000;
+    Y = 0;
+    Z = 0;
+    GPS_APP_Geo_EcefToEnu(&Ref, &X, &Y, &Z, &E, &N, &U, 1);
+    MaxError = fmax(MaxError, fabs(E) + fabs(N) + fabs(U - 1000));
+
+    X = 0;
+    Y = GPS_APP_GEO_A;
+    GPS_APP_Geo_EcefToEnu(&Ref, &X, &Y, &Z, &E, &N, &U, 1);
+    MaxError = fmax(MaxError, fabs(E - GPS_APP_GEO_A) + fabs(N) + fabs(U + GPS_APP_GEO_A));
+
+    /*
+    ** Round trip over the benchmark batch: a grid of latitudes, longitudes
+    ** and altitudes from the surface to low Earth orbit
+    */
+    GPS_APP_Geo_SetReference(&Ref, 18.2101, -67.1411, 25.0);
+    for (i = 0; i < GPS_APP_GEO_BENCH_COUNT; i++)
+    {
+        Bench[0][i] = -89.0 + 178.0 * i / GPS_APP_GEO_BENCH_COUNT;
+        Bench[1][i] = -179.0 + (i * 37 % 358);
+        Bench[2][i] = (i % 8) * 100000.0;
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+    for (i = 0; i < GPS_APP_GEO_BENCH_LOOPS; i++)
+    {
+        GPS_APP_Geo_LlaToEcef(Bench[0], Bench[1], Bench[2], Bench[3], Bench[4], Bench[5], GPS_APP_GEO_BENCH_COUNT);
+        GPS_APP_Geo_EcefToEnu(&Ref, Bench[3], Bench[4], Bench[5], Bench[6], Bench[7], Bench[8],
+                              GPS_APP_GEO_BENCH_COUNT);
+        GPS_APP_Geo_EnuToEcef(&Ref, Bench[6], Bench[7], Bench[8], Bench[3], Bench[4], Bench[5],
+                              GPS_APP_GEO_BENCH_COUNT);
+        GPS_APP_Geo_EcefToLla(Bench[3], Bench[4], Bench[5], Bench[6], Bench[7], Bench[8], GPS_APP_GEO_BENCH_COUNT);
+    }
+    CFE_PSP_GetTime(&EndTime);
+
+    Usec = GPS_APP_DeltaUsec(StartTime, EndTime);
+    if (Usec == 0)
+    {
+        Usec = 1;
+    }
+    *FixesPerSec = (uint32)(((uint64)GPS_APP_GEO_BENCH_COUNT * GPS_APP_GEO_BENCH_LOOPS * 1000000) / Usec);
+
+    for (i = 0; i < GPS_APP_GEO_BENCH_COUNT; i++)
+    {
+        Lat = Bench[6][i] - Bench[0][i];
+        Lon = remainder(Bench[7][i] - Bench[1][i], 360.0);
+        Alt = Bench[8][i] - Bench[2][i];
+
+        /*
+        ** Angles to meters on the surface, good enough for a tolerance check
+        */
+        Error = fabs(Lat) * GPS_APP_GEO_DEG2RAD * GPS_APP_GEO_A +
+                fabs(Lon) * GPS_APP_GEO_DEG2RAD * GPS_APP_GEO_A * cos(Bench[0][i] * GPS_APP_GEO_DEG2RAD) + fabs(Alt);
+        MaxError = fmax(MaxError, Error);
+    }
+
+    *MaxErrorM = MaxError;
+
+    return (MaxError <= GPS_APP_GEO_SELFTEST_TOL_M) ? CFE_SUCCESS : CFE_STATUS_VALIDATION_FAILURE;
+}
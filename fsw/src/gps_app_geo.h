@@ -0,0 +1,75 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * WGS-84 geodetic conversions for the GPS App
+ *
+ * The kernels take structure-of-arrays input (one array per coordinate) and
+ * process Count fixes per call with no branches in the loop body, so the
+ * compiler can vectorize them. Latitude and longitude are in degrees, all
+ * distances in meters. A single fix is just Count = 1.
+ */
+
+#ifndef GPS_APP_GEO_H
+#define GPS_APP_GEO_H
+
+#include "cfe.h"
+
+/*
+** WGS-84 ellipsoid
+*/
+#define GPS_APP_GEO_A  6378137.0                              /* Semi-major axis */
+#define GPS_APP_GEO_F  (1.0 / 298.257223563)                  /* Flattening */
+#define GPS_APP_GEO_B  (GPS_APP_GEO_A * (1.0 - GPS_APP_GEO_F)) /* Semi-minor axis */
+#define GPS_APP_GEO_E2 (GPS_APP_GEO_F * (2.0 - GPS_APP_GEO_F)) /* First eccentricity squared */
+
+/*
+** Local ENU frame origin, with the rotation terms precomputed
+*/
+typedef struct
+{
+    double Lat;
+    double Lon;
+    double Alt;
+    double X0;
+    double Y0;
+    double Z0;
+    double SinLat;
+    double CosLat;
+    double SinLon;
+    double CosLon;
+} GPS_APP_GeoRef_t;
+
+void GPS_APP_Geo_SetReference(GPS_APP_GeoRef_t *Ref, double Lat, double Lon, double Alt);
+
+void GPS_APP_Geo_LlaToEcef(const double *restrict Lat, const double *restrict Lon, const double *restrict Alt,
+                           double *restrict X, double *restrict Y, double *restrict Z, uint32 Count);
+void GPS_APP_Geo_EcefToLla(const double *restrict X, const double *restrict Y, const double *restrict Z,
+                           double *restrict Lat, double *restrict Lon, double *restrict Alt, uint32 Count);
+void GPS_APP_Geo_EcefToEnu(const GPS_APP_GeoRef_t *Ref, const double *restrict X, const double *restrict Y,
+                           const double *restrict Z, double *restrict E, double *restrict N, double *restrict U,
+                           uint32 Count);
+void GPS_APP_Geo_EnuToEcef(const GPS_APP_GeoRef_t *Ref, const double *restrict E, const double *restrict N,
+                           const double *restrict U, double *restrict X, double *restrict Y, double *restrict Z,
+                           uint32 Count);
+
+int32 GPS_APP_Geo_SelfTest(double *MaxErrorM, uint32 *FixesPerSec);
+
+#endif /* GPS_APP_GEO_H */
@@ -0,0 +1,550 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Command pipe load accounting and load generator for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/*
+** Messages sent by the load generator, one per subscribed MID
+*/
+static GPS_APP_NoArgsCmd_t GPS_APP_LoadGenMsg[GPS_APP_LOAD_NUM_MIDS];
+
+/*
+** Subscribed MID value at each load table index
+*/
+static const uint32 GPS_APP_LoadMidValue[GPS_APP_LOAD_NUM_MIDS] = {
+    GPS_APP_CMD_MID,   GPS_APP_SEND_HK_MID,  GPS_APP_SEND_RF_MID, GPS_APP_READ_MID,
+    GPS_APP_CYCLE_MID, GPS_APP_EST_TICK_MID, GPS_APP_SEND_SV_MID};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Map a subscribed MID to its load table index, -1 if not subscribed         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_Load_MidIndex(CFE_SB_MsgId_t MsgId)
+{
+    int32 Index;
+
+    switch (CFE_SB_MsgIdToValue(MsgId))
+    {
+        case GPS_APP_CMD_MID:
+            Index = GPS_APP_LOAD_CMD_IDX;
+            break;
+        case GPS_APP_SEND_HK_MID:
+            Index = GPS_APP_LOAD_SEND_HK_IDX;
+            break;
+        case GPS_APP_SEND_RF_MID:
+            Index = GPS_APP_LOAD_SEND_RF_IDX;
+            break;
+        case GPS_APP_READ_MID:
+            Index = GPS_APP_LOAD_READ_IDX;
+            break;
+        case GPS_APP_CYCLE_MID:
+            Index = GPS_APP_LOAD_CYCLE_IDX;
+            break;
+        case GPS_APP_EST_TICK_MID:
+            Index = GPS_APP_LOAD_EST_IDX;
+            break;
+        case GPS_APP_SEND_SV_MID:
+            Index = GPS_APP_LOAD_SV_IDX;
+            break;
+        default:
+            Index = -1;
+            break;
+    }
+
+    return Index;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Clear the load data and set the default handler deadlines                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Load_Init(void)
+{
+    GPS_APP_LoadData_t *Load = &GPS_APP_Data.Load;
+
+    memset(Load, 0, sizeof(*Load));
+    Load->TaskId = CFE_ES_TASKID_UNDEFINED;
+
+    Load->DeadlineUs[GPS_APP_LOAD_CMD_IDX]     = GPS_APP_DEADLINE_CMD_US;
+    Load->DeadlineUs[GPS_APP_LOAD_SEND_HK_IDX] = GPS_APP_DEADLINE_SEND_HK_US;
+    Load->DeadlineUs[GPS_APP_LOAD_SEND_RF_IDX] = GPS_APP_DEADLINE_SEND_RF_US;
+    Load->DeadlineUs[GPS_APP_LOAD_READ_IDX]    = GPS_APP_DEADLINE_READ_US;
+    Load->DeadlineUs[GPS_APP_LOAD_CYCLE_IDX]   = GPS_APP_DEADLINE_CYCLE_US;
+    Load->DeadlineUs[GPS_APP_LOAD_EST_IDX]     = GPS_APP_DEADLINE_EST_US;
+    Load->DeadlineUs[GPS_APP_LOAD_SV_IDX]      = GPS_APP_DEADLINE_SV_US;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Clear the dispatch counters                                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Load_ResetCounters(void)
+{
+    memset(GPS_APP_Data.Load.Mid, 0, sizeof(GPS_APP_Data.Load.Mid));
+
+    GPS_APP_Data.Load.ServiceTimeMaxUs  = 0;
+    GPS_APP_Data.Load.QueueLatencyMaxUs = 0;
+    GPS_APP_Data.Load.DropRate          = 0;
+    GPS_APP_Data.Load.Overruns          = 0;
+    GPS_APP_Data.Load.WindowOpen        = false;
+    GPS_APP_Data.Load.WindowOverruns    = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Count a handler that ran past its deadline. Only the first overrun */
+/*         in each event window is reported, with how many the last window    */
+/*         held.                                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Load_Overrun(int32 Index, uint32 Usec, OS_time_t EndTime)
+{
+    GPS_APP_LoadData_t *Load = &GPS_APP_Data.Load;
+    uint32              Previous;
+
+    Load->Mid[Index].Overruns++;
+    Load->Overruns++;
+
+    if (Load->WindowOpen &&
+        GPS_APP_DeltaUsec(Load->WindowStart, EndTime) < (uint32)GPS_APP_DEADLINE_WINDOW_MS * 1000)
+    {
+        Load->WindowOverruns++;
+        return;
+    }
+
+    Previous = Load->WindowOverruns;
+
+    Load->WindowOpen     = true;
+    Load->WindowStart    = EndTime;
+    Load->WindowOverruns = 1;
+
+    CFE_EVS_SendEvent(GPS_APP_DEADLINE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "GPS: MID 0x%04X handler took %u us, deadline %u us (%u overruns in the last window)",
+                      (unsigned int)GPS_APP_LoadMidValue[Index], (unsigned int)Usec,
+                      (unsigned int)Load->DeadlineUs[Index], (unsigned int)Previous);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Account for one packet taken off the command pipe. Called after    */
+/*         the handler returns, StartTime is when the packet was received.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void GPS_APP_Load_RecordDispatch(const CFE_SB_Buffer_t *SBBufPtr, CFE_SB_MsgId_t MsgId, OS_time_t StartTime)
+{
+    GPS_APP_LoadData_t *    Load = &GPS_APP_Data.Load;
+    GPS_APP_LoadMidStats_t *Stats;
+    CFE_MSG_SequenceCount_t Seq = 0;
+    OS_time_t               EndTime;
+    uint32                  Usec;
+    int32                   Index;
+    bool                    Generated;
+
+    Index = GPS_APP_Load_MidIndex(MsgId);
+    if (Index < 0)
+    {
+        return;
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+    CFE_MSG_GetSequenceCount(&SBBufPtr->Msg, &Seq);
+
+    Stats = &Load->Mid[Index];
+    Stats->Handled++;
+
+    /*
+    ** Only the generator's own packets carry a sequence count we can trust.
+    ** Ground commands come with the ground tool's count, so nothing outside
+    ** a run, or on a MID the run doesn't send, is checked for gaps.
+    */
+    Generated = (Load->State == GPS_APP_LOADGEN_RUNNING && Load->Generated[Index]);
+
+    /*
+    ** Anything between the last sequence count and this one was dropped
+    ** by SB on a full pipe
+    */
+    if (Generated)
+    {
+        if (Stats->SeqValid)
+        {
+            Stats->Lost += (Seq - Stats->LastSeq - 1) & GPS_APP_LOAD_SEQ_MASK;
+        }
+        Stats->LastSeq  = Seq;
+        Stats->SeqValid = true;
+    }
+
+    Usec = GPS_APP_DeltaUsec(StartTime, EndTime);
+    if (Usec > Stats->WcetUs)
+    {
+        Stats->WcetUs = Usec;
+    }
+    if (Load->DeadlineUs[Index] != 0 && Usec > Load->DeadlineUs[Index])
+    {
+        GPS_APP_Load_Overrun(Index, Usec, EndTime);
+    }
+    if (Usec > Load->ServiceTimeMaxUs)
+    {
+        Load->ServiceTimeMaxUs = Usec;
+    }
+    if (Usec > Load->StepServiceTimeMaxUs)
+    {
+        Load->StepServiceTimeMaxUs = Usec;
+    }
+
+    /*
+    ** Time spent queued is only known for packets the generator stamped
+    */
+    if (Generated)
+    {
+        Usec = GPS_APP_DeltaUsec(Load->SendTime[Index][Seq % GPS_APP_LOAD_SEQ_RING], StartTime);
+        if (Usec > Load->QueueLatencyMaxUs)
+        {
+            Load->QueueLatencyMaxUs = Usec;
+        }
+        if (Usec > Load->StepQueueLatencyMaxUs)
+        {
+            Load->StepQueueLatencyMaxUs = Usec;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fill Top with the Count MIDs that overran most often, ties broken  */
+/*         by the longest handler run relative to the deadline.               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Load_TopOffenders(GPS_APP_DeadlineStats_t *Top, uint32 Count)
+{
+    const GPS_APP_LoadData_t *Load = &GPS_APP_Data.Load;
+    bool                      Taken[GPS_APP_LOAD_NUM_MIDS] = {false};
+    int32                     Best;
+    int32                     i;
+    uint32                    n;
+
+    memset(Top, 0, Count * sizeof(*Top));
+
+    for (n = 0; n < Count && n < GPS_APP_LOAD_NUM_MIDS; n++)
+    {
+        Best = -1;
+        for (i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+        {
+            if (Taken[i])
+            {
+                continue;
+            }
+            if (Best < 0 || Load->Mid[i].Overruns > Load->Mid[Best].Overruns ||
+                (Load->Mid[i].Overruns == Load->Mid[Best].Overruns &&
+                 (uint64)Load->Mid[i].WcetUs * (Load->DeadlineUs[Best] + 1) >
+                     (uint64)Load->Mid[Best].WcetUs * (Load->DeadlineUs[i] + 1)))
+            {
+                Best = i;
+            }
+        }
+
+        Taken[Best]       = true;
+        Top[n].MsgId      = GPS_APP_LoadMidValue[Best];
+        Top[n].Overruns   = Load->Mid[Best].Overruns;
+        Top[n].WcetUs     = Load->Mid[Best].WcetUs;
+        Top[n].DeadlineUs = Load->DeadlineUs[Best];
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS set handler deadline command                                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_SetDeadline(const GPS_APP_SetDeadlineCmd_t *Msg)
+{
+    int32 Index;
+
+    Index = GPS_APP_Load_MidIndex(CFE_SB_ValueToMsgId(Msg->Payload.MsgId));
+    if (Index < 0)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_DEADLINE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: MID 0x%04X is not subscribed, no deadline set", (unsigned int)Msg->Payload.MsgId);
+        return CFE_SUCCESS;
+    }
+
+    GPS_APP_Data.Load.DeadlineUs[Index] = Msg->Payload.DeadlineUs;
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_DEADLINE_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: MID 0x%04X deadline set to %u us",
+                      (unsigned int)Msg->Payload.MsgId, (unsigned int)Msg->Payload.DeadlineUs);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Start load generator command                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_LoadGenStart(const GPS_APP_LoadGenStartCmd_t *Msg)
+{
+    const GPS_APP_LoadGenStart_Payload_t *Cfg  = &Msg->Payload;
+    GPS_APP_LoadData_t *                  Load = &GPS_APP_Data.Load;
+    int32                                 status;
+    int32                                 i;
+
+    if (Load->State != GPS_APP_LOADGEN_IDLE)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: load generator already running");
+        return CFE_SUCCESS;
+    }
+
+    if (Cfg->StepCount == 0 || Cfg->StepCount > GPS_APP_LOADGEN_MAX_STEPS || Cfg->StepDurationMs == 0 ||
+        (Cfg->CmdWeight + Cfg->SendHkWeight + Cfg->SendRfWeight + Cfg->ReadWeight) == 0)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: invalid load generator config: steps = %u, duration = %u ms",
+                          (unsigned int)Cfg->StepCount, (unsigned int)Cfg->StepDurationMs);
+        return CFE_SUCCESS;
+    }
+
+    Load->Config      = *Cfg;
+    Load->Step        = 0;
+    Load->StopRequest = false;
+    GPS_APP_Load_ResetCounters();
+
+    /*
+    ** Note which MIDs this run sends, and make the first packet on each
+    ** resync the sequence count
+    */
+    memset(Load->Generated, 0, sizeof(Load->Generated));
+    Load->Generated[GPS_APP_LOAD_CMD_IDX]     = (Cfg->CmdWeight != 0);
+    Load->Generated[GPS_APP_LOAD_SEND_HK_IDX] = (Cfg->SendHkWeight != 0);
+    Load->Generated[GPS_APP_LOAD_SEND_RF_IDX] = (Cfg->SendRfWeight != 0);
+    Load->Generated[GPS_APP_LOAD_READ_IDX]    = (Cfg->ReadWeight != 0);
+    for (i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+    {
+        Load->Mid[i].SeqValid = false;
+    }
+
+    uC_sim_set_latency(Cfg->SimBusLatencyUs);
+
+    /*
+    ** Set before the task exists so dispatches it causes are timed
+    */
+    Load->State = GPS_APP_LOADGEN_RUNNING;
+
+    status = CFE_ES_CreateChildTask(&Load->TaskId, GPS_APP_LOADGEN_TASK_NAME, GPS_APP_LoadGen_Task,
+                                    CFE_ES_TASK_STACK_ALLOCATE, GPS_APP_LOADGEN_STACK_SIZE,
+                                    GPS_APP_LOADGEN_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        Load->State = GPS_APP_LOADGEN_IDLE;
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: failed to create load generator task, RC = 0x%08lX", (unsigned long)status);
+        return status;
+    }
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: load generator started, %u steps from %u msg/s by %u msg/s",
+                      (unsigned int)Cfg->StepCount, (unsigned int)Cfg->StartRate, (unsigned int)Cfg->RateStep);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Stop load generator command                                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_LoadGenStop(const GPS_APP_LoadGenStopCmd_t *Msg)
+{
+    GPS_APP_Data.Load.StopRequest = true;
+    GPS_APP_Data.CmdCounter++;
+
+    CFE_EVS_SendEvent(GPS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: load generator stop requested");
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Pick the next MID by smooth weighted round robin                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_LoadGen_NextIndex(int32 Credit[GPS_APP_LOAD_NUM_MIDS], const uint16 Weight[GPS_APP_LOAD_NUM_MIDS])
+{
+    int32 Total = 0;
+    int32 Best  = 0;
+    int32 i;
+
+    for (i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+    {
+        Credit[i] += Weight[i];
+        Total += Weight[i];
+        if (Credit[i] > Credit[Best])
+        {
+            Best = i;
+        }
+    }
+
+    Credit[Best] -= Total;
+
+    return Best;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Load generator child task. Each step sends at a fixed rate for     */
+/*         the step duration, waits for the pipe to drain and reports how     */
+/*         many packets the app handled, lost and how long they waited.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_LoadGen_Task(void)
+{
+    GPS_APP_LoadData_t *Load = &GPS_APP_Data.Load;
+    uint16              Weight[GPS_APP_LOAD_NUM_MIDS];
+    int32               Credit[GPS_APP_LOAD_NUM_MIDS];
+    uint32              HandledBefore;
+    uint32              LostBefore;
+    uint32              Handled;
+    uint32              Lost;
+    uint32              Rate;
+    uint32              Sent;
+    uint32              Due;
+    uint32              ElapsedMs;
+    int32               Index;
+    int32               i;
+
+    Weight[GPS_APP_LOAD_CMD_IDX]     = Load->Config.CmdWeight;
+    Weight[GPS_APP_LOAD_SEND_HK_IDX] = Load->Config.SendHkWeight;
+    Weight[GPS_APP_LOAD_SEND_RF_IDX] = Load->Config.SendRfWeight;
+    Weight[GPS_APP_LOAD_READ_IDX]    = Load->Config.ReadWeight;
+    Weight[GPS_APP_LOAD_CYCLE_IDX]   = 0;
+    Weight[GPS_APP_LOAD_EST_IDX]     = 0;
+    Weight[GPS_APP_LOAD_SV_IDX]      = 0;
+
+    for (i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+    {
+        CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_LoadGenMsg[i].CmdHeader), CFE_SB_ValueToMsgId(GPS_APP_LoadMidValue[i]),
+                     sizeof(GPS_APP_LoadGenMsg[i]));
+        Credit[i] = 0;
+    }
+    CFE_MSG_SetFcnCode(CFE_MSG_PTR(GPS_APP_LoadGenMsg[GPS_APP_LOAD_CMD_IDX].CmdHeader), GPS_APP_NOOP_CC);
+
+    for (Load->Step = 0; Load->Step < Load->Config.StepCount && !Load->StopRequest; Load->Step++)
+    {
+        Rate          = Load->Config.StartRate + Load->Step * Load->Config.RateStep;
+        Sent          = 0;
+        HandledBefore = 0;
+        LostBefore    = 0;
+        for (i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+        {
+            if (Load->Generated[i])
+            {
+                HandledBefore += Load->Mid[i].Handled;
+                LostBefore += Load->Mid[i].Lost;
+            }
+        }
+        Load->StepServiceTimeMaxUs  = 0;
+        Load->StepQueueLatencyMaxUs = 0;
+
+        /*
+        ** Send whatever is due each millisecond to hold the step rate
+        */
+        for (ElapsedMs = 1; ElapsedMs <= Load->Config.StepDurationMs && !Load->StopRequest; ElapsedMs++)
+        {
+            Due = (uint32)(((uint64)Rate * ElapsedMs) / 1000);
+            while (Sent < Due)
+            {
+                Index = GPS_APP_LoadGen_NextIndex(Credit, Weight);
+
+                /*
+                ** Stamp our own sequence count so the app can match the
+                ** packet to its send time and spot the ones SB dropped
+                */
+                Load->GenSeq[Index] = (Load->GenSeq[Index] + 1) & GPS_APP_LOAD_SEQ_MASK;
+                CFE_MSG_SetSequenceCount(CFE_MSG_PTR(GPS_APP_LoadGenMsg[Index].CmdHeader), Load->GenSeq[Index]);
+                CFE_PSP_GetTime(&Load->SendTime[Index][Load->GenSeq[Index] % GPS_APP_LOAD_SEQ_RING]);
+
+                CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_LoadGenMsg[Index].CmdHeader), false);
+                Sent++;
+            }
+
+            OS_TaskDelay(1);
+        }
+
+        OS_TaskDelay(GPS_APP_LOADGEN_DRAIN_MS);
+
+        Handled = 0;
+        Lost    = 0;
+        for (i = 0; i < GPS_APP_LOAD_NUM_MIDS; i++)
+        {
+            if (Load->Generated[i])
+            {
+                Handled += Load->Mid[i].Handled;
+                Lost += Load->Mid[i].Lost;
+            }
+        }
+        Handled -= HandledBefore;
+        Lost -= LostBefore;
+
+        /*
+        ** A packet lost on the last send of a step only shows up as a gap
+        ** once the next one arrives, so also count what never got handled
+        */
+        if (Sent > Handled && (Sent - Handled) > Lost)
+        {
+            Lost = Sent - Handled;
+        }
+
+        if (Lost > 0 && Load->DropRate == 0)
+        {
+            Load->DropRate = Rate;
+        }
+
+        CFE_EVS_SendEvent(GPS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "GPS: load step %u: %u msg/s, sent %u, handled %u, lost %u, svc max %u us, queue max %u us",
+                          (unsigned int)Load->Step, (unsigned int)Rate, (unsigned int)Sent, (unsigned int)Handled,
+                          (unsigned int)Lost, (unsigned int)Load->StepServiceTimeMaxUs,
+                          (unsigned int)Load->StepQueueLatencyMaxUs);
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: load generator finished, drop rate = %u msg/s", (unsigned int)Load->DropRate);
+
+    Load->State = GPS_APP_LOADGEN_IDLE;
+
+    CFE_ES_ExitChildTask();
+}
@@ -0,0 +1,121 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Command pipe load accounting and load generator for the GPS App
+ *
+ * Every packet taken off the command pipe is counted per MID. While the load
+ * generator runs, gaps in the CCSDS sequence count of the MIDs it sends are
+ * counted as packets lost before they reached the app (the pipe was full when
+ * SB tried to deliver them). The load generator is a
+ * child task that floods the pipe with a commanded mix of MIDs at a stepped
+ * rate, so the drop point can be measured on the target.
+ *
+ * Each handler's run time is also checked against a per-MID deadline. An
+ * overrun is counted against its MID, and the first overrun in each
+ * GPS_APP_DEADLINE_WINDOW_MS raises an event; the rest of that window's
+ * overruns are only counted and summarized in the next event.
+ */
+
+#ifndef GPS_APP_LOAD_H
+#define GPS_APP_LOAD_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+
+/*
+** Index of each subscribed MID in the load tables
+*/
+#define GPS_APP_LOAD_CMD_IDX     0
+#define GPS_APP_LOAD_SEND_HK_IDX 1
+#define GPS_APP_LOAD_SEND_RF_IDX 2
+#define GPS_APP_LOAD_READ_IDX    3
+#define GPS_APP_LOAD_CYCLE_IDX   4 /* Accounted for, but never sent by the generator */
+#define GPS_APP_LOAD_EST_IDX     5 /* Likewise */
+#define GPS_APP_LOAD_SV_IDX      6 /* Likewise */
+#define GPS_APP_LOAD_NUM_MIDS    7
+
+#define GPS_APP_LOAD_SEQ_MASK 0x3FFF /* CCSDS sequence count is 14 bits */
+#define GPS_APP_LOAD_SEQ_RING 256    /* Send times kept per MID, must exceed the pipe depth */
+
+/*
+** Load generator states
+*/
+#define GPS_APP_LOADGEN_IDLE    0
+#define GPS_APP_LOADGEN_RUNNING 1
+
+typedef struct
+{
+    uint32 Handled;
+    uint32 Lost;
+    uint16 LastSeq;
+    bool   SeqValid;
+    uint32 Overruns; /* Handler runs past the MID's deadline */
+    uint32 WcetUs;   /* Longest handler run */
+} GPS_APP_LoadMidStats_t;
+
+typedef struct
+{
+    /*
+    ** Dispatch accounting (main task)
+    */
+    GPS_APP_LoadMidStats_t Mid[GPS_APP_LOAD_NUM_MIDS];
+    uint32                 ServiceTimeMaxUs;
+    uint32                 QueueLatencyMaxUs;
+
+    /*
+    ** Deadline monitor. Deadlines survive a counter reset.
+    */
+    uint32    DeadlineUs[GPS_APP_LOAD_NUM_MIDS]; /* 0 disables the check */
+    uint32    Overruns;
+    bool      WindowOpen;
+    OS_time_t WindowStart;    /* First overrun of the current event window */
+    uint32    WindowOverruns; /* Overruns in it */
+
+    /*
+    ** Per-step maxima, cleared by the generator at the start of each step
+    */
+    uint32 StepServiceTimeMaxUs;
+    uint32 StepQueueLatencyMaxUs;
+
+    /*
+    ** Load generator (child task)
+    */
+    CFE_ES_TaskId_t                TaskId;
+    volatile uint8                 State;
+    volatile bool                  StopRequest;
+    uint8                          Step;
+    uint32                         DropRate;
+    GPS_APP_LoadGenStart_Payload_t Config;
+    bool                           Generated[GPS_APP_LOAD_NUM_MIDS]; /* MIDs the current run sends */
+    uint16                         GenSeq[GPS_APP_LOAD_NUM_MIDS];
+    OS_time_t                      SendTime[GPS_APP_LOAD_NUM_MIDS][GPS_APP_LOAD_SEQ_RING];
+} GPS_APP_LoadData_t;
+
+void  GPS_APP_Load_Init(void);
+void  GPS_APP_Load_ResetCounters(void);
+void  GPS_APP_Load_RecordDispatch(const CFE_SB_Buffer_t *SBBufPtr, CFE_SB_MsgId_t MsgId, OS_time_t StartTime);
+void  GPS_APP_Load_TopOffenders(GPS_APP_DeadlineStats_t *Top, uint32 Count);
+int32 GPS_APP_SetDeadline(const GPS_APP_SetDeadlineCmd_t *Msg);
+int32 GPS_APP_LoadGenStart(const GPS_APP_LoadGenStartCmd_t *Msg);
+int32 GPS_APP_LoadGenStop(const GPS_APP_LoadGenStopCmd_t *Msg);
+void  GPS_APP_LoadGen_Task(void);
+
+#endif /* GPS_APP_LOAD_H */
@@ -0,0 +1,570 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Onboard binary fix log for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Name of the file for a slot in the log ring                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_FileName(char *Path, size_t Size, uint32 Slot)
+{
+    snprintf(Path, Size, "%s/gps_log_%u.dat", GPS_APP_LOG_DIR, (unsigned int)Slot);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuild the directory entry of a file left by an earlier run from  */
+/*         the first record of each whole block. A trailing partial block     */
+/*         from a short write is ignored, and so is the padding of a block    */
+/*         flushed at exit.                                                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_ScanFile(uint32 Slot)
+{
+    GPS_APP_LogData_t * Log  = &GPS_APP_Data.Log;
+    GPS_APP_LogFile_t * File = &Log->Files[Slot];
+    GPS_APP_LogRecord_t Rec;
+    char                Path[OS_MAX_PATH_LEN];
+    osal_id_t           Fd;
+    int32               Size;
+    uint32              Blocks;
+    uint32              Block;
+    uint32              Last;
+
+    GPS_APP_Log_FileName(Path, sizeof(Path), Slot);
+    if (OS_OpenCreate(&Fd, Path, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    Size   = OS_lseek(Fd, 0, OS_SEEK_END);
+    Blocks = (Size > 0) ? (uint32)Size / GPS_APP_LOG_BLOCK_SIZE : 0;
+    if (Blocks > GPS_APP_LOG_BLOCKS_PER_FILE)
+    {
+        Blocks = GPS_APP_LOG_BLOCKS_PER_FILE;
+    }
+
+    for (Block = 0; Block < Blocks; Block++)
+    {
+        OS_lseek(Fd, Block * GPS_APP_LOG_BLOCK_SIZE, OS_SEEK_SET);
+        if (OS_read(Fd, &Rec, sizeof(Rec)) != sizeof(Rec))
+        {
+            break;
+        }
+        File->Index[Block] = Rec.Seconds;
+    }
+
+    if (Block > 0)
+    {
+        OS_lseek(Fd, (Block - 1) * GPS_APP_LOG_BLOCK_SIZE, OS_SEEK_SET);
+        if (OS_read(Fd, Log->QueryBlock, sizeof(Log->QueryBlock)) == sizeof(Log->QueryBlock))
+        {
+            Last = GPS_APP_LOG_RECORDS_PER_BLOCK;
+            while (Last > 1 && Log->QueryBlock[Last - 1].Seconds == GPS_APP_LOG_PAD_SECONDS)
+            {
+                Last--;
+            }
+
+            File->Blocks       = Block;
+            File->FirstSeconds = File->Index[0];
+            File->LastSeconds  = Log->QueryBlock[Last - 1].Seconds;
+            File->InUse        = true;
+        }
+    }
+
+    OS_close(Fd);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuild the directory from the files already in the ring, so logs  */
+/*         from before an app restart can still be extracted, and resume      */
+/*         writing at the slot after the newest file.                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_Recover(void)
+{
+    GPS_APP_LogData_t *Log    = &GPS_APP_Data.Log;
+    uint32             Found  = 0;
+    int32              Newest = -1;
+    uint32             Slot;
+
+    for (Slot = 0; Slot < GPS_APP_LOG_MAX_FILES; Slot++)
+    {
+        GPS_APP_Log_ScanFile(Slot);
+
+        if (Log->Files[Slot].InUse)
+        {
+            Found++;
+            if (Newest < 0 || Log->Files[Slot].LastSeconds >= Log->Files[Newest].LastSeconds)
+            {
+                Newest = Slot;
+            }
+        }
+    }
+
+    if (Newest < 0)
+    {
+        return;
+    }
+
+    Log->Slot = (Newest + 1) % GPS_APP_LOG_MAX_FILES;
+
+    CFE_EVS_SendEvent(GPS_APP_LOG_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: found %u log files, newest in slot %u, writing from slot %u", (unsigned int)Found,
+                      (unsigned int)Newest, (unsigned int)Log->Slot);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Pick up the existing log ring and create the writer task                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Log_Init(void)
+{
+    GPS_APP_LogData_t *Log = &GPS_APP_Data.Log;
+    int32              status;
+
+    memset(Log, 0, sizeof(*Log));
+
+    GPS_APP_Log_Recover();
+
+    status = OS_MutSemCreate(&Log->DirMutex, GPS_APP_LOG_MUTEX_NAME, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating log mutex, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = OS_BinSemCreate(&Log->DoneSem, GPS_APP_LOG_SEM_NAME, OS_SEM_EMPTY, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating log semaphore, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = CFE_ES_CreateChildTask(&Log->TaskId, GPS_APP_LOG_TASK_NAME, GPS_APP_Log_WriterTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE, GPS_APP_LOG_STACK_SIZE, GPS_APP_LOG_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error creating log writer task, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Stop the writer on app exit and wait for it to flush the queued fixes      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Log_Close(void)
+{
+    __atomic_store_n(&GPS_APP_Data.Log.Stop, true, __ATOMIC_RELEASE);
+
+    if (OS_BinSemTimedWait(GPS_APP_Data.Log.DoneSem, GPS_APP_LOG_CLOSE_MS) != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Log writer did not flush within %u ms\n", (unsigned int)GPS_APP_LOG_CLOSE_MS);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Queue a committed fix for the writer. Producer side of the SPSC    */
+/*         queue: never blocks, a full queue drops the record and counts it.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Log_Push(const GPS_APP_Sample_t *Sample)
+{
+    GPS_APP_LogData_t *  Log  = &GPS_APP_Data.Log;
+    uint32               Head = Log->Head;
+    uint32               Tail = __atomic_load_n(&Log->Tail, __ATOMIC_ACQUIRE);
+    GPS_APP_LogRecord_t *Rec;
+    CFE_TIME_SysTime_t   Now;
+
+    if (Head - Tail >= GPS_APP_LOG_QUEUE_DEPTH)
+    {
+        Log->Dropped++;
+        return;
+    }
+
+    Now = CFE_TIME_GetTime();
+
+    Rec             = &Log->Queue[Head & (GPS_APP_LOG_QUEUE_DEPTH - 1)];
+    Rec->Seconds    = Now.Seconds;
+    Rec->Subseconds = Now.Subseconds;
+    Rec->latitude   = Sample->latitude;
+    Rec->longitude  = Sample->longitude;
+    Rec->altitude   = Sample->altitude;
+    Rec->satellites = Sample->satellites;
+    Rec->Seq        = Log->Seq++;
+
+    /*
+    ** Publish the record only once it is complete
+    */
+    __atomic_store_n(&Log->Head, Head + 1, __ATOMIC_RELEASE);
+
+    if (Head + 1 - Tail > Log->QueueHwm)
+    {
+        Log->QueueHwm = Head + 1 - Tail;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Bytes per second achieved while writing                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 GPS_APP_Log_WriteRate(void)
+{
+    const GPS_APP_LogData_t *Log = &GPS_APP_Data.Log;
+
+    return (Log->WriteUs == 0) ? 0 : (uint32)(((uint64)Log->BytesWritten * 1000000) / Log->WriteUs);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Close the current file and move to the next slot                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_CloseFile(void)
+{
+    GPS_APP_LogData_t *Log = &GPS_APP_Data.Log;
+
+    OS_close(Log->Fd);
+    Log->FileOpen = false;
+
+    Log->Slot = (Log->Slot + 1) % GPS_APP_LOG_MAX_FILES;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Write the block buffer to the current file and index it                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_WriteBlock(void)
+{
+    GPS_APP_LogData_t *Log  = &GPS_APP_Data.Log;
+    GPS_APP_LogFile_t *File = &Log->Files[Log->Slot];
+    char               Path[OS_MAX_PATH_LEN];
+    OS_time_t          StartTime;
+    OS_time_t          EndTime;
+    int32              rc;
+
+    if (!Log->FileOpen)
+    {
+        /*
+        ** Drop the slot from the directory before its file is truncated
+        */
+        OS_MutSemTake(Log->DirMutex);
+        File->InUse  = false;
+        File->Blocks = 0;
+        OS_MutSemGive(Log->DirMutex);
+
+        GPS_APP_Log_FileName(Path, sizeof(Path), Log->Slot);
+        rc = OS_OpenCreate(&Log->Fd, Path, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+        if (rc != OS_SUCCESS)
+        {
+            Log->WriteErrors++;
+            return;
+        }
+        Log->FileOpen = true;
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+    rc = OS_write(Log->Fd, Log->Block, sizeof(Log->Block));
+    CFE_PSP_GetTime(&EndTime);
+
+    if (rc != sizeof(Log->Block))
+    {
+        /*
+        ** A short write leaves the file off block alignment, start a new one
+        */
+        Log->WriteErrors++;
+        GPS_APP_Log_CloseFile();
+        return;
+    }
+
+    Log->WriteUs += GPS_APP_DeltaUsec(StartTime, EndTime);
+    Log->BytesWritten += sizeof(Log->Block);
+
+    OS_MutSemTake(Log->DirMutex);
+    if (File->Blocks == 0)
+    {
+        File->FirstSeconds = Log->Block[0].Seconds;
+    }
+    File->Index[File->Blocks] = Log->Block[0].Seconds;
+    File->LastSeconds         = Log->Block[Log->BlockFill - 1].Seconds;
+    File->Blocks++;
+    File->InUse = true;
+    OS_MutSemGive(Log->DirMutex);
+
+    if (File->Blocks == GPS_APP_LOG_BLOCKS_PER_FILE)
+    {
+        GPS_APP_Log_CloseFile();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Move everything queued into the block buffer, writing each block   */
+/*         as it fills. Consumer side of the SPSC queue.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_Drain(void)
+{
+    GPS_APP_LogData_t *Log  = &GPS_APP_Data.Log;
+    uint32             Head = __atomic_load_n(&Log->Head, __ATOMIC_ACQUIRE);
+    uint32             Tail = Log->Tail;
+
+    while (Tail != Head)
+    {
+        Log->Block[Log->BlockFill++] = Log->Queue[Tail & (GPS_APP_LOG_QUEUE_DEPTH - 1)];
+
+        /*
+        ** Hand the slot back as soon as it is copied out
+        */
+        Tail++;
+        __atomic_store_n(&Log->Tail, Tail, __ATOMIC_RELEASE);
+
+        if (Log->BlockFill == GPS_APP_LOG_RECORDS_PER_BLOCK)
+        {
+            GPS_APP_Log_WriteBlock();
+            Log->BlockFill = 0;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writer child task, low priority. Drains the queue every poll       */
+/*         period. On exit it drains what is left and pads the last partial   */
+/*         block out to a whole one, so every fix queued reaches the file.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Log_WriterTask(void)
+{
+    GPS_APP_LogData_t *Log = &GPS_APP_Data.Log;
+
+    while (GPS_APP_Data.RunStatus == CFE_ES_RunStatus_APP_RUN && !__atomic_load_n(&Log->Stop, __ATOMIC_ACQUIRE))
+    {
+        OS_TaskDelay(GPS_APP_LOG_POLL_MS);
+        GPS_APP_Log_Drain();
+    }
+
+    GPS_APP_Log_Drain();
+
+    if (Log->BlockFill > 0)
+    {
+        memset(&Log->Block[Log->BlockFill], 0xFF,
+               (GPS_APP_LOG_RECORDS_PER_BLOCK - Log->BlockFill) * sizeof(GPS_APP_LogRecord_t));
+        GPS_APP_Log_WriteBlock();
+        Log->BlockFill = 0;
+    }
+
+    if (Log->FileOpen)
+    {
+        GPS_APP_Log_CloseFile();
+    }
+
+    OS_BinSemGive(Log->DoneSem);
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copy the records of one log file between Start and End seconds to  */
+/*         the output file, starting at the block the index points to. Works  */
+/*         from the QueryFile copy of the directory entry, without DirMutex.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Log_ExtractFile(uint32 Slot, uint32 Start, uint32 End, osal_id_t OutFd)
+{
+    GPS_APP_LogData_t *      Log  = &GPS_APP_Data.Log;
+    const GPS_APP_LogFile_t *File = &Log->QueryFile;
+    char                     Path[OS_MAX_PATH_LEN];
+    osal_id_t                InFd;
+    uint32                   Lo = 0;
+    uint32                   Hi = File->Blocks;
+    uint32                   Mid;
+    uint32                   Block;
+    uint32                   First;
+    uint32                   Last;
+    bool                     Done = false;
+
+    /*
+    ** First block that starts at or after Start; the one before it may end
+    ** with records from Start, so begin there
+    */
+    while (Lo < Hi)
+    {
+        Mid = (Lo + Hi) / 2;
+        if (File->Index[Mid] < Start)
+        {
+            Lo = Mid + 1;
+        }
+        else
+        {
+            Hi = Mid;
+        }
+    }
+    Block = (Lo > 0) ? Lo - 1 : 0;
+
+    GPS_APP_Log_FileName(Path, sizeof(Path), Slot);
+    if (OS_OpenCreate(&InFd, Path, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    OS_lseek(InFd, Block * GPS_APP_LOG_BLOCK_SIZE, OS_SEEK_SET);
+
+    for (; Block < File->Blocks && !Done; Block++)
+    {
+        if (OS_read(InFd, Log->QueryBlock, sizeof(Log->QueryBlock)) != sizeof(Log->QueryBlock))
+        {
+            break;
+        }
+        Log->QueryBlocks++;
+
+        /*
+        ** The writer has reused the slot since the directory was copied
+        */
+        if (Log->QueryBlock[0].Seconds != File->Index[Block])
+        {
+            break;
+        }
+
+        /*
+        ** Records are in time order, so the matches are one run
+        */
+        for (First = 0; First < GPS_APP_LOG_RECORDS_PER_BLOCK && Log->QueryBlock[First].Seconds < Start; First++)
+            ;
+        for (Last = First; Last < GPS_APP_LOG_RECORDS_PER_BLOCK && Log->QueryBlock[Last].Seconds <= End &&
+                           Log->QueryBlock[Last].Seconds != GPS_APP_LOG_PAD_SECONDS;
+             Last++)
+            ;
+
+        Done = (Last < GPS_APP_LOG_RECORDS_PER_BLOCK);
+
+        if (Last > First)
+        {
+            OS_write(OutFd, &Log->QueryBlock[First], (Last - First) * sizeof(GPS_APP_LogRecord_t));
+            Log->QueryRecords += Last - First;
+        }
+    }
+
+    OS_close(InFd);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Extract a time range from the log to a file for downlink. Only     */
+/*         records already written are seen, not the writer's partial block.  */
+/*         DirMutex is only held to copy each directory entry, so a long      */
+/*         extract never holds up the writer.                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_LogExtract(const GPS_APP_LogExtractCmd_t *Msg)
+{
+    GPS_APP_LogData_t *      Log   = &GPS_APP_Data.Log;
+    uint32                   Start = Msg->Payload.StartSeconds;
+    uint32                   End   = Msg->Payload.EndSeconds;
+    const GPS_APP_LogFile_t *File  = &Log->QueryFile;
+    char                     Filename[OS_MAX_PATH_LEN];
+    OS_time_t                StartTime;
+    OS_time_t                EndTime;
+    osal_id_t                OutFd;
+    uint32                   Oldest;
+    uint32                   Slot;
+    uint32                   i;
+    int32                    status;
+
+    strncpy(Filename, Msg->Payload.Filename, sizeof(Filename) - 1);
+    Filename[sizeof(Filename) - 1] = 0;
+
+    if (Start > End)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_LOG_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: log extract start %u after end %u",
+                          (unsigned int)Start, (unsigned int)End);
+        return CFE_SUCCESS;
+    }
+
+    status = OS_OpenCreate(&OutFd, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (status != OS_SUCCESS)
+    {
+        GPS_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(GPS_APP_LOG_ERR_EID, CFE_EVS_EventType_ERROR, "GPS: error creating %s, RC = %d", Filename,
+                          (int)status);
+        return CFE_SUCCESS;
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+    Log->QueryBlocks  = 0;
+    Log->QueryRecords = 0;
+
+    /*
+    ** Walk the ring oldest first so the output is in time order
+    */
+    Oldest = __atomic_load_n(&Log->Slot, __ATOMIC_RELAXED);
+    for (i = 1; i <= GPS_APP_LOG_MAX_FILES; i++)
+    {
+        Slot = (Oldest + i) % GPS_APP_LOG_MAX_FILES;
+
+        OS_MutSemTake(Log->DirMutex);
+        Log->QueryFile = Log->Files[Slot];
+        OS_MutSemGive(Log->DirMutex);
+
+        if (File->InUse && File->LastSeconds >= Start && File->FirstSeconds <= End)
+        {
+            GPS_APP_Log_ExtractFile(Slot, Start, End, OutFd);
+        }
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+    Log->QueryUs = GPS_APP_DeltaUsec(StartTime, EndTime);
+
+    OS_close(OutFd);
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_LOG_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: extracted %u records to %s, %u blocks read in %u us", (unsigned int)Log->QueryRecords,
+                      Filename, (unsigned int)Log->QueryBlocks, (unsigned int)Log->QueryUs);
+
+    return CFE_SUCCESS;
+}
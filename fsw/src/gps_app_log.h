@@ -0,0 +1,130 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Onboard binary fix log for the GPS App
+ *
+ * Every committed fix is pushed onto a single-producer/single-consumer queue
+ * (the app's main task produces, the writer child task consumes). The writer
+ * packs records into fixed-size blocks and writes whole blocks to a ring of
+ * log files, so every write is one block at a block-aligned offset. For each
+ * file it keeps the time of the first record in every block; the range
+ * extract command uses that index to seek straight to the first block that
+ * can hold the start time instead of scanning the files. At startup the index
+ * is rebuilt from the files already in the ring, and writing resumes after
+ * the newest one. At app exit the writer drains the queue and writes the last
+ * partial block padded out to a whole one, so no fix is lost.
+ */
+
+#ifndef GPS_APP_LOG_H
+#define GPS_APP_LOG_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_sample.h"
+#include "gps_app_platform_cfg.h"
+
+/*
+** One log record, fixed size
+*/
+typedef struct
+{
+    uint32 Seconds;    /* CFE time of the fix */
+    uint32 Subseconds;
+    float  latitude;
+    float  longitude;
+    float  altitude;
+    uint8  satellites;
+    uint8  spare[3];
+    uint32 Seq;        /* Records logged since the app started */
+    uint32 spare2;
+} GPS_APP_LogRecord_t;
+
+#define GPS_APP_LOG_RECORDS_PER_BLOCK (GPS_APP_LOG_BLOCK_SIZE / sizeof(GPS_APP_LogRecord_t))
+
+/*
+** Padding after the last record of a block flushed at exit is all ones
+*/
+#define GPS_APP_LOG_PAD_SECONDS 0xFFFFFFFF
+
+#if (GPS_APP_LOG_QUEUE_DEPTH & (GPS_APP_LOG_QUEUE_DEPTH - 1)) != 0
+#error GPS_APP_LOG_QUEUE_DEPTH must be a power of two
+#endif
+
+/*
+** One file in the log ring and its time index
+*/
+typedef struct
+{
+    bool   InUse;
+    uint32 Blocks;
+    uint32 FirstSeconds;
+    uint32 LastSeconds;
+    uint32 Index[GPS_APP_LOG_BLOCKS_PER_FILE]; /* Seconds of the first record in each block */
+} GPS_APP_LogFile_t;
+
+typedef struct
+{
+    /*
+    ** Queue. Head is written only by the producer, Tail only by the consumer.
+    */
+    GPS_APP_LogRecord_t Queue[GPS_APP_LOG_QUEUE_DEPTH];
+    uint32              Head;
+    uint32              Tail;
+    uint32              QueueHwm;
+    uint32              Dropped;
+    uint32              Seq;
+
+    /*
+    ** Writer task
+    */
+    CFE_ES_TaskId_t     TaskId;
+    osal_id_t           DirMutex; /* Guards Files between the writer and range queries */
+    osal_id_t           DoneSem;  /* Given once the writer has flushed at exit */
+    bool                Stop;
+    osal_id_t           Fd;
+    bool                FileOpen;
+    uint32              Slot;
+    GPS_APP_LogRecord_t Block[GPS_APP_LOG_RECORDS_PER_BLOCK];
+    uint32              BlockFill;
+    GPS_APP_LogFile_t   Files[GPS_APP_LOG_MAX_FILES];
+    uint32              BytesWritten;
+    uint32              WriteErrors;
+    uint32              WriteUs;      /* Time spent in OS_write, for the write rate */
+
+    /*
+    ** Last range query. QueryFile is a copy of one directory entry, taken
+    ** under DirMutex so the file I/O can run without it.
+    */
+    GPS_APP_LogFile_t   QueryFile;
+    GPS_APP_LogRecord_t QueryBlock[GPS_APP_LOG_RECORDS_PER_BLOCK];
+    uint32              QueryUs;
+    uint32              QueryBlocks;
+    uint32              QueryRecords;
+} GPS_APP_LogData_t;
+
+int32  GPS_APP_Log_Init(void);
+void   GPS_APP_Log_Close(void);
+void   GPS_APP_Log_Push(const GPS_APP_Sample_t *Sample);
+uint32 GPS_APP_Log_WriteRate(void);
+int32  GPS_APP_LogExtract(const GPS_APP_LogExtractCmd_t *Msg);
+void   GPS_APP_Log_WriterTask(void);
+
+#endif /* GPS_APP_LOG_H */
@@ -30,6 +30,67 @@
 */
 #define GPS_APP_NOOP_CC           0
 #define GPS_APP_RESET_COUNTERS_CC 1
+#define GPS_APP_LOADGEN_START_CC  2
+#define GPS_APP_LOADGEN_STOP_CC   3
+#define GPS_APP_SET_ENU_REF_CC    4
+#define GPS_APP_GEO_SELFTEST_CC   5
+#define GPS_APP_SET_CYCLE_CC      6
+#define GPS_APP_SET_READ_PATH_CC  7
+#define GPS_APP_READ_BENCH_CC     8
+#define GPS_APP_LOG_EXTRACT_CC    9
+#define GPS_APP_RESET_STATS_CC    10
+#define GPS_APP_BURST_ARM_CC      11
+#define GPS_APP_BURST_DRAIN_CC    12
+#define GPS_APP_SET_DEADLINE_CC   13
+
+/*
+** Fix read paths
+*/
+#define GPS_APP_READ_PATH_RAW    0 /* ioctl on the I2C bus per fix */
+#define GPS_APP_READ_PATH_DEVICE 1 /* read() on the registered genuC device */
+#define GPS_APP_READ_PATH_COUNT  2
+
+/*
+** Velocity sources
+*/
+#define GPS_APP_VEL_SOURCE_NONE     0 /* No velocity yet, or after a fix gap */
+#define GPS_APP_VEL_SOURCE_DIFF     1 /* Differenced fixes */
+#define GPS_APP_VEL_SOURCE_RECEIVER 2 /* Receiver velocity solution */
+
+/*
+** Output stream fields, in the order they are packed
+*/
+#define GPS_APP_STREAM_LAT        (1U << 0) /* Full: double deg, compact: int32 1e-7 deg */
+#define GPS_APP_STREAM_LON        (1U << 1) /* Likewise */
+#define GPS_APP_STREAM_ALT        (1U << 2) /* Full: double m, compact: int32 mm */
+#define GPS_APP_STREAM_SATS       (1U << 3) /* uint8 in both */
+#define GPS_APP_STREAM_SPEED      (1U << 4) /* Full: float m/s, compact: uint16 cm/s */
+#define GPS_APP_STREAM_COURSE     (1U << 5) /* Full: float deg, compact: uint16 0.01 deg */
+#define GPS_APP_STREAM_VRATE      (1U << 6) /* Full: float m/s, compact: int16 cm/s */
+#define GPS_APP_STREAM_ENU        (1U << 7) /* East, North, Up. Full: 3 double m, compact: 3 int32 cm */
+#define GPS_APP_STREAM_ECEF       (1U << 8) /* X, Y, Z. Likewise */
+#define GPS_APP_STREAM_NUM_FIELDS 9
+#define GPS_APP_STREAM_ALL_FIELDS ((1U << GPS_APP_STREAM_NUM_FIELDS) - 1)
+
+/*
+** Output stream encodings
+*/
+#define GPS_APP_STREAM_FULL      0
+#define GPS_APP_STREAM_COMPACT   1
+#define GPS_APP_STREAM_ENCODINGS 2
+
+/*
+** Poll rate modes
+*/
+#define GPS_APP_POLL_IDLE 0 /* Every GPS_APP_POLL_IDLE_DIVISOR'th read wakeup */
+#define GPS_APP_POLL_FAST 1 /* Every read wakeup */
+
+/*
+** Burst capture states
+*/
+#define GPS_APP_BURST_IDLE      0
+#define GPS_APP_BURST_CAPTURING 1
+#define GPS_APP_BURST_DRAINING  2
 
 /*************************************************************************/
 
@@ -50,6 +111,162 @@ typedef struct
 */
 typedef GPS_APP_NoArgsCmd_t GPS_APP_NoopCmd_t;
 typedef GPS_APP_NoArgsCmd_t GPS_APP_ResetCountersCmd_t;
+typedef GPS_APP_NoArgsCmd_t GPS_APP_LoadGenStopCmd_t;
+typedef GPS_APP_NoArgsCmd_t GPS_APP_GeoSelfTestCmd_t;
+typedef GPS_APP_NoArgsCmd_t GPS_APP_ResetStatsCmd_t;
+
+/*
+** Type definition (start the command pipe load generator)
+**
+** The generator sends the four subscribed MIDs in proportion to their weights,
+** starting at StartRate messages per second and adding RateStep after every
+** StepDurationMs, for StepCount steps.
+*/
+typedef struct
+{
+    uint16 CmdWeight;       /**< \brief Weight of GPS_APP_CMD_MID (NOOP) */
+    uint16 SendHkWeight;    /**< \brief Weight of GPS_APP_SEND_HK_MID */
+    uint16 SendRfWeight;    /**< \brief Weight of GPS_APP_SEND_RF_MID */
+    uint16 ReadWeight;      /**< \brief Weight of GPS_APP_READ_MID */
+    uint32 StartRate;       /**< \brief Messages per second in the first step */
+    uint32 RateStep;        /**< \brief Messages per second added each step */
+    uint32 StepCount;       /**< \brief Number of steps */
+    uint32 StepDurationMs;  /**< \brief Duration of each step */
+    uint32 SimBusLatencyUs; /**< \brief Transfer latency of the simulated bus, if built in */
+} GPS_APP_LoadGenStart_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        CmdHeader; /**< \brief Command header */
+    GPS_APP_LoadGenStart_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_LoadGenStartCmd_t;
+
+/*
+** Type definition (set the origin of the local ENU frame)
+*/
+typedef struct
+{
+    double Latitude;  /**< \brief Degrees */
+    double Longitude; /**< \brief Degrees */
+    double Altitude;  /**< \brief Meters above the WGS-84 ellipsoid */
+} GPS_APP_SetEnuRef_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t     CmdHeader; /**< \brief Command header */
+    GPS_APP_SetEnuRef_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_SetEnuRefCmd_t;
+
+/*
+** Type definition (enable or disable the pipelined read/publish cycle)
+*/
+typedef struct
+{
+    uint8  Enable;        /**< \brief 1 to publish from GPS_APP_CYCLE_MID wakeups */
+    uint8  spare[3];
+    uint32 PhaseOffsetMs; /**< \brief Delay from wakeup to the start of the next read */
+} GPS_APP_SetCycle_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t    CmdHeader; /**< \brief Command header */
+    GPS_APP_SetCycle_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_SetCycleCmd_t;
+
+/*
+** Type definition (select the fix read path)
+*/
+typedef struct
+{
+    uint8 Path; /**< \brief GPS_APP_READ_PATH_RAW or GPS_APP_READ_PATH_DEVICE */
+    uint8 spare[3];
+} GPS_APP_SetReadPath_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CmdHeader; /**< \brief Command header */
+    GPS_APP_SetReadPath_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_SetReadPathCmd_t;
+
+/*
+** Type definition (time fix reads over both paths)
+*/
+typedef struct
+{
+    uint32 Count; /**< \brief Fixes read over each path */
+} GPS_APP_ReadBench_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t     CmdHeader; /**< \brief Command header */
+    GPS_APP_ReadBench_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_ReadBenchCmd_t;
+
+/*
+** Type definition (extract a time range of the fix log)
+*/
+typedef struct
+{
+    uint32 StartSeconds;               /**< \brief First CFE time second to extract */
+    uint32 EndSeconds;                 /**< \brief Last CFE time second to extract */
+    char   Filename[OS_MAX_PATH_LEN];  /**< \brief Output file */
+} GPS_APP_LogExtract_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t      CmdHeader; /**< \brief Command header */
+    GPS_APP_LogExtract_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_LogExtractCmd_t;
+
+/*
+** Type definition (arm a burst capture)
+**
+** The capture stops at whichever limit is reached first. Zero selects the
+** largest allowed value.
+*/
+typedef struct
+{
+    uint32 DurationMs; /**< \brief Capture length, at most GPS_APP_BURST_MAX_DURATION_MS */
+    uint32 MaxSamples; /**< \brief Fixes to capture, at most GPS_APP_BURST_RING_SIZE */
+    uint32 PeriodMs;   /**< \brief Delay between reads, 0 to read back to back */
+} GPS_APP_BurstArm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t    CmdHeader; /**< \brief Command header */
+    GPS_APP_BurstArm_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_BurstArmCmd_t;
+
+/*
+** Type definition (downlink the burst ring)
+*/
+typedef struct
+{
+    uint16 PacketsPerSec; /**< \brief Drain rate, at most GPS_APP_BURST_MAX_PKT_RATE */
+    uint8  spare[2];
+} GPS_APP_BurstDrain_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t      CmdHeader; /**< \brief Command header */
+    GPS_APP_BurstDrain_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_BurstDrainCmd_t;
+
+/*
+** Type definition (set the handler deadline for one subscribed MID)
+*/
+typedef struct
+{
+    uint16 MsgId;      /**< \brief Subscribed MID value */
+    uint8  spare[2];
+    uint32 DeadlineUs; /**< \brief Handler run time allowed, 0 to stop checking */
+} GPS_APP_SetDeadline_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CmdHeader; /**< \brief Command header */
+    GPS_APP_SetDeadline_Payload_t Payload;   /**< \brief Command payload */
+} GPS_APP_SetDeadlineCmd_t;
 
 /*************************************************************************/
 /*
@@ -65,6 +282,79 @@ typedef struct
     float longitude;
     float altitude;
     uint8 satellites;
+    uint8 LoadGenState;
+    uint8 LoadGenStep;
+    uint8 spare2;
+    uint32 MsgsHandled;       /* Packets taken off the command pipe */
+    uint32 MsgsLost;          /* Sequence count gaps, i.e. packets dropped by SB */
+    uint32 ServiceTimeMaxUs;  /* Longest single packet handler */
+    uint32 QueueLatencyMaxUs; /* Longest generator-to-handler delay */
+    uint32 LoadGenDropRate;   /* First generator rate (msg/s) that lost packets */
+    uint32 FenceInsideMask;   /* Bit per geofence table entry the last fix was inside */
+    uint32 FenceCandidates;   /* Regions given the exact test on the last fix */
+    uint32 FenceEvalTimeUs;   /* Geofence time for the last fix */
+    uint32 FenceEvalTimeMaxUs;
+    uint32 TtffMs;            /* Time to first fix since the app started, 0 until one */
+    uint8  StartType;         /* GPS_APP_START_COLD, _WARM or _AIDED */
+    uint8  CycleEnabled;
+    uint8  ReadPath;          /* GPS_APP_READ_PATH_RAW or _DEVICE */
+    uint8  spare3;
+    uint32 CycleCount;
+    uint32 CycleLateCount;    /* Wakeups that found the previous read still in flight */
+    uint32 CycleTransferUs;   /* Duration of the last cycle bus transfer */
+    uint32 CycleLatencyUs;    /* Transfer complete to RF packet sent */
+    uint32 CycleLatencyMaxUs;
+    uint32 CycleSkipped;      /* READ and SEND_RF wakeups ignored in cycle mode */
+    uint32 ReadRawAvgUs;      /* Per-fix transfer time over each read path */
+    uint32 ReadRawMaxUs;
+    uint32 ReadDeviceAvgUs;
+    uint32 ReadDeviceMaxUs;
+    uint32 LogRecords;        /* Fixes queued for the log */
+    uint32 LogDropped;        /* Fixes lost to a full log queue */
+    uint32 LogQueueHwm;
+    uint32 LogBytesWritten;
+    uint32 LogWriteRateBps;   /* Bytes per second of time spent writing */
+    uint32 LogWriteErrors;
+    uint32 LogQueryUs;        /* Duration of the last range extract */
+    uint32 LogQueryBlocks;    /* Blocks it read */
+    uint32 LogQueryRecords;   /* Records it extracted */
+    uint32 EstTicks;
+    uint32 EstResets;         /* Estimator restarts and frame moves */
+    uint32 EstTickUs;         /* Propagate and publish time, last and worst */
+    uint32 EstTickMaxUs;
+    uint32 EstUpdateMaxUs;    /* Worst fix update time */
+    float  GroundSpeed;       /* m/s */
+    float  CourseDeg;         /* Course over ground from true north */
+    float  VerticalRate;      /* m/s, up positive */
+    uint8  VelSource;         /* GPS_APP_VEL_SOURCE_... */
+    uint8  spare4[3];
+    uint32 VelUs;             /* Velocity stage cost per fix, last and worst */
+    uint32 VelMaxUs;
+    uint8  SvVisible;         /* SVs in the last satellite table */
+    uint8  SvUsed;            /* Of those, used in the solution */
+    uint8  spare5[2];
+    uint32 SvErrors;          /* Satellite table reads that failed or did not decode */
+    uint32 SvEntriesSent;
+    uint32 SvLastPktBytes;
+    uint8  BurstState;        /* GPS_APP_BURST_IDLE, _CAPTURING or _DRAINING */
+    uint8  spare6[3];
+    uint32 BurstCaptured;     /* Fixes stored by the last burst */
+    uint32 BurstRejected;     /* Fixes that failed validation */
+    uint32 BurstDuplicates;   /* Reads that repeated the previous fix */
+    uint32 BurstReadErrors;
+    float  BurstRateHz;       /* Capture rate achieved */
+    uint32 BurstDrained;      /* Records sent, of BurstCaptured */
+    uint32 ValidAccepted;     /* Samples that passed validation */
+    uint32 ValidRejectFinite; /* Rejected for a NaN or infinite field */
+    uint32 ValidRejectRange;  /* Latitude, longitude or altitude out of range */
+    uint32 ValidRejectSats;   /* Too few satellites */
+    uint32 ValidRejectJump;   /* Moved further than the vehicle could have */
+    uint8  PollMode;          /* GPS_APP_POLL_IDLE or _FAST */
+    uint8  spare7[3];
+    uint32 PollModeChanges;
+    uint32 PollNavRateErrors; /* Receiver rate changes that failed */
+    float  PollRateHz;        /* Reads per second since the last housekeeping */
+    float  PollBusDuty;       /* Percent of that time the uC bus was busy, all tasks */
 } GPS_APP_HkTlm_Payload_t;
 
 typedef struct
@@ -80,8 +370,8 @@ typedef struct
     uint8 byte_group_2[4];    // Longitude
     uint8 byte_group_3[4];    // Altitude
     uint8 byte_group_4[4];    // [Satellites, 0, 0, 0]
-    uint8 byte_group_5[4];    // empty
-    uint8 byte_group_6[4];    // empty
+    uint8 byte_group_5[4];    // Ground speed, m/s
+    uint8 byte_group_6[4];    // [Course over ground (uint16, 0.01 deg), Vertical rate (int16, cm/s)]
 } GPS_APP_OutData_t;
 
 typedef struct
@@ -90,4 +380,223 @@ typedef struct
     GPS_APP_HkTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } GPS_APP_HkTlm_t;
 
+/*
+** Type definition (GPS App diagnostics, sent with housekeeping)
+*/
+#define GPS_APP_DEADLINE_TOP 3 /* MIDs reported, most overruns first */
+
+typedef struct
+{
+    uint16 MsgId;
+    uint8  spare[2];
+    uint32 Overruns;
+    uint32 WcetUs;     /* Longest handler run */
+    uint32 DeadlineUs;
+} GPS_APP_DeadlineStats_t;
+
+#define GPS_APP_STREAM_MAX 8 /* Output stream table entries */
+
+typedef struct
+{
+    uint16 MsgId;      /* 0 for an unused entry */
+    uint16 Divisor;
+    uint32 Packets;
+    uint32 BuildUs;    /* Packing time, last and worst */
+    uint32 BuildMaxUs;
+} GPS_APP_StreamStats_t;
+
+typedef struct
+{
+    uint32 DrvOpenErrors;     /* uC driver failures by kind */
+    uint32 DrvTransferErrors;
+    uint32 DrvAllocErrors;
+    int32  DrvLastErrno;
+    uint8  DrvLastKind;       /* uC_error_kind of the last driver failure */
+    uint8  spare[3];
+    uint32 FetchFailures;     /* Fixes the app failed to fetch */
+    uint32 DeadlineOverruns;  /* Handler runs past their MID's deadline, all MIDs */
+    GPS_APP_DeadlineStats_t Top[GPS_APP_DEADLINE_TOP];
+    uint32 StreamEncodeUs;    /* Field encoding shared by the streams, last fix */
+    GPS_APP_StreamStats_t Stream[GPS_APP_STREAM_MAX]; /* Per stream table entry */
+} GPS_APP_DiagTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_DiagTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} GPS_APP_DiagTlm_t;
+
+/*
+** Type definition (GPS App position statistics, sent with housekeeping)
+*/
+#define GPS_APP_STATS_LAT  0
+#define GPS_APP_STATS_LON  1
+#define GPS_APP_STATS_ALT  2
+#define GPS_APP_STATS_AXES 3
+
+typedef struct
+{
+    double Mean;         /* Since the last reset */
+    double StdDev;
+    double Min;
+    double Max;
+    double WindowMean;   /* Over the last WindowFill fixes */
+    double WindowStdDev;
+} GPS_APP_AxisStats_t;
+
+typedef struct
+{
+    uint32              Count;      /* Fixes since the last reset */
+    uint32              WindowFill;
+    GPS_APP_AxisStats_t Axis[GPS_APP_STATS_AXES]; /* Latitude, longitude (degrees), altitude (m) */
+} GPS_APP_StatsTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_StatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} GPS_APP_StatsTlm_t;
+
+/*
+** Type definition (GPS App estimate, sent on every estimator tick)
+*/
+#define GPS_APP_EST_EAST  0
+#define GPS_APP_EST_NORTH 1
+#define GPS_APP_EST_UP    2
+#define GPS_APP_EST_AXES  3
+
+typedef struct
+{
+    double Latitude;                  /* Degrees */
+    double Longitude;                 /* Degrees */
+    double Altitude;                  /* Meters */
+    double Pos[GPS_APP_EST_AXES];     /* ENU meters from the origin below */
+    double Vel[GPS_APP_EST_AXES];     /* ENU m/s */
+    double PosVar[GPS_APP_EST_AXES];  /* m^2 */
+    double PosVelCov[GPS_APP_EST_AXES];
+    double VelVar[GPS_APP_EST_AXES];  /* m^2/s^2 */
+    double OriginLat;
+    double OriginLon;
+    double OriginAlt;
+    uint32 FixAgeMs;                  /* Time propagated since the last fix */
+    uint32 spare;
+} GPS_APP_EstTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_EstTlm_Payload_t  Payload;         /**< \brief Telemetry payload */
+} GPS_APP_EstTlm_t;
+
+/*
+** Type definition (GPS App satellite table, changed entries only)
+*/
+#define GPS_APP_SV_MAX 24 /* Satellite table capacity */
+
+#define GPS_APP_SV_CHANGE_UPDATE 0 /* New SV, or changed since last sent */
+#define GPS_APP_SV_CHANGE_LOST   1 /* No longer tracked, drop it */
+
+typedef struct
+{
+    uint8 SvId;
+    uint8 Cno;     /* dBHz */
+    int8  Elev;    /* Degrees */
+    uint8 Quality; /* NAV-SVINFO quality indicator */
+    int16 Azim;    /* Degrees */
+    uint8 Flags;   /* NAV-SVINFO flags */
+    uint8 Change;  /* GPS_APP_SV_CHANGE_... */
+} GPS_APP_SvEntry_t;
+
+typedef struct
+{
+    uint32            Itow;       /* Receiver time of week of the table, ms */
+    uint16            Sequence;
+    uint8             NumSv;      /* SVs in the table */
+    uint8             NumEntries; /* Entries that follow, the packet ends after them */
+    uint8             Keyframe;   /* 1 if Entries is the whole table */
+    uint8             spare[3];
+    GPS_APP_SvEntry_t Entries[2 * GPS_APP_SV_MAX]; /* Room for a full table lost and replaced */
+} GPS_APP_SvTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_SvTlm_Payload_t   Payload;         /**< \brief Telemetry payload */
+} GPS_APP_SvTlm_t;
+
+/*
+** Type definition (GPS App burst capture, one batch of the ring per packet)
+*/
+#define GPS_APP_BURST_BATCH 32 /* Fixes per drain packet */
+
+typedef struct
+{
+    uint32 Seconds;    /* CFE time of the read */
+    uint32 Subseconds;
+    float  latitude;
+    float  longitude;
+    float  altitude;
+    uint8  satellites;
+    uint8  spare[3];
+} GPS_APP_BurstRecord_t;
+
+typedef struct
+{
+    uint32                BurstId;    /* Arm command this burst came from */
+    uint32                FirstIndex; /* Position in the burst of Records[0] */
+    uint32                Remaining;  /* Records still in the ring after this packet */
+    uint16                NumRecords; /* Records that follow, the packet ends after them */
+    uint8                 spare[2];
+    GPS_APP_BurstRecord_t Records[GPS_APP_BURST_BATCH];
+} GPS_APP_BurstTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_BurstTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} GPS_APP_BurstTlm_t;
+
+/*
+** Type definition (GPS App output stream, fields packed in bit order)
+*/
+#define GPS_APP_STREAM_MAX_BYTES 88 /* Every field, full encoding */
+
+typedef struct
+{
+    uint32 FieldMask;  /* GPS_APP_STREAM_... fields present */
+    uint8  Encoding;   /* GPS_APP_STREAM_FULL or _COMPACT */
+    uint8  spare[3];
+    uint8  Data[GPS_APP_STREAM_MAX_BYTES]; /* The packet ends after the last field */
+} GPS_APP_StreamTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_StreamTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} GPS_APP_StreamTlm_t;
+
+/*
+** Type definition (GPS App geodetic telemetry, sent with every RF packet)
+*/
+typedef struct
+{
+    double Latitude;  /* Degrees */
+    double Longitude; /* Degrees */
+    double Altitude;  /* Meters */
+    double EcefX;     /* Meters, WGS-84 ECEF */
+    double EcefY;
+    double EcefZ;
+    double East;      /* Meters from the commanded reference, zero until one is set */
+    double North;
+    double Up;
+    uint8  EnuRefValid;
+    uint8  spare[7];
+} GPS_APP_GeoTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    GPS_APP_GeoTlm_Payload_t  Payload;         /**< \brief Telemetry payload */
+} GPS_APP_GeoTlm_t;
+
 #endif /* GPS_APP_MSG_H */
@@ -0,0 +1,260 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Adaptive poll rate for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Start in the idle mode                                                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Poll_Init(void)
+{
+    memset(&GPS_APP_Data.Poll, 0, sizeof(GPS_APP_Data.Poll));
+    GPS_APP_Data.Poll.Mode = GPS_APP_POLL_IDLE;
+    CFE_PSP_GetTime(&GPS_APP_Data.Poll.WindowStart);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Read wakeups per read in a mode                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 GPS_APP_Poll_Divisor(uint8 Mode)
+{
+    return (Mode == GPS_APP_POLL_FAST) ? 1 : GPS_APP_POLL_IDLE_DIVISOR;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Set the receiver's measurement rate to the poll rate with UBX      */
+/*         CFG-RATE, through the uC that owns its serial port.                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_Poll_SendNavRate(uint8 Mode)
+{
+    uint8     Frame[GPS_APP_UBX_FRAME_LEN(GPS_APP_UBX_CFG_RATE_LEN)];
+    uint8 *   FramePtr = Frame;
+    uint16    MeasRateMs;
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    uint8     CkA = 0;
+    uint8     CkB = 0;
+    uint32    i;
+    int       rc;
+
+    MeasRateMs = (uint16)(1000 * GPS_APP_Poll_Divisor(Mode) / GPS_APP_POLL_WAKEUP_HZ);
+
+    Frame[0]  = GPS_APP_UBX_SYNC1;
+    Frame[1]  = GPS_APP_UBX_SYNC2;
+    Frame[2]  = GPS_APP_UBX_CLASS_CFG;
+    Frame[3]  = GPS_APP_UBX_ID_CFG_RATE;
+    Frame[4]  = GPS_APP_UBX_CFG_RATE_LEN;
+    Frame[5]  = 0;
+    Frame[6]  = (uint8)(MeasRateMs & 0xFF);
+    Frame[7]  = (uint8)(MeasRateMs >> 8);
+    Frame[8]  = 1; /* One navigation solution per measurement */
+    Frame[9]  = 0;
+    Frame[10] = GPS_APP_UBX_TIME_REF_GPS;
+    Frame[11] = 0;
+
+    /*
+    ** 8-bit Fletcher checksum over class, id, length and payload
+    */
+    for (i = 2; i < sizeof(Frame) - 2; i++)
+    {
+        CkA += Frame[i];
+        CkB += CkA;
+    }
+    Frame[sizeof(Frame) - 2] = CkA;
+    Frame[sizeof(Frame) - 1] = CkB;
+
+    CFE_PSP_GetTime(&StartTime);
+    rc = uC_set_bytes(UC_ADDRESS, &FramePtr, sizeof(Frame));
+    CFE_PSP_GetTime(&EndTime);
+    GPS_APP_Dev_AccountBus(GPS_APP_DeltaUsec(StartTime, EndTime));
+
+    return rc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Switch modes and tell the ground, and the receiver if configured           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Poll_SetMode(uint8 Mode, double Speed, double Accel, double MoveRate)
+{
+    GPS_APP_PollData_t *Poll = &GPS_APP_Data.Poll;
+
+    Poll->Mode    = Mode;
+    Poll->Wakeups = 0;
+    Poll->Quiet   = false;
+    Poll->ModeChanges++;
+
+    if (GPS_APP_POLL_SET_NAV_RATE && GPS_APP_Poll_SendNavRate(Mode) != 0)
+    {
+        Poll->NavRateErrors++;
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_POLL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "GPS: poll rate %s to %u Hz, speed %.1f m/s, accel %.2f m/s^2, position rate %.1f m/s",
+                      (Mode == GPS_APP_POLL_FAST) ? "raised" : "lowered",
+                      (unsigned int)(GPS_APP_POLL_WAKEUP_HZ / GPS_APP_Poll_Divisor(Mode)), Speed, Accel, MoveRate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* True if this read wakeup should read the receiver, counting the read       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool GPS_APP_Poll_Due(void)
+{
+    GPS_APP_PollData_t *Poll = &GPS_APP_Data.Poll;
+
+    if (Poll->Wakeups == 0)
+    {
+        Poll->Wakeups = GPS_APP_Poll_Divisor(Poll->Mode) - 1;
+        Poll->Reads++;
+        return true;
+    }
+
+    Poll->Wakeups--;
+
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Pick the poll rate from a committed fix. Called after the velocity */
+/*         and geodetic stages have run on it.                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Poll_Update(const GPS_APP_Sample_t *Sample)
+{
+    GPS_APP_PollData_t *            Poll = &GPS_APP_Data.Poll;
+    const GPS_APP_GeoTlm_Payload_t *Geo  = &GPS_APP_Data.GeoTlm.Payload;
+    double                          Speed;
+    double                          Accel;
+    double                          MoveRate;
+    double                          Dt;
+    double                          Dx, Dy, Dz;
+    uint32                          Usec;
+
+    Speed = sqrt((double)GPS_APP_Data.Vel.GroundSpeed * GPS_APP_Data.Vel.GroundSpeed +
+                 (double)GPS_APP_Data.Vel.VertRate * GPS_APP_Data.Vel.VertRate);
+
+    Usec = GPS_APP_DeltaUsec(Poll->PrevTime, Sample->AcquiredTime);
+
+    /*
+    ** Both are per second, so the thresholds mean the same at either poll
+    ** rate
+    */
+    if (Poll->PrevValid && Usec > 0)
+    {
+        Dt       = Usec / 1.0e6;
+        Accel    = fabs(Speed - Poll->PrevSpeed) / Dt;
+        Dx       = Geo->EcefX - Poll->PrevEcef[0];
+        Dy       = Geo->EcefY - Poll->PrevEcef[1];
+        Dz       = Geo->EcefZ - Poll->PrevEcef[2];
+        MoveRate = sqrt(Dx * Dx + Dy * Dy + Dz * Dz) / Dt;
+    }
+    else
+    {
+        Accel    = 0.0;
+        MoveRate = 0.0;
+    }
+
+    Poll->PrevValid   = true;
+    Poll->PrevSpeed   = Speed;
+    Poll->PrevEcef[0] = Geo->EcefX;
+    Poll->PrevEcef[1] = Geo->EcefY;
+    Poll->PrevEcef[2] = Geo->EcefZ;
+    Poll->PrevTime    = Sample->AcquiredTime;
+
+    if (Speed > GPS_APP_POLL_RAISE_SPEED || Accel > GPS_APP_POLL_RAISE_ACCEL || MoveRate > GPS_APP_POLL_RAISE_MOVE_RATE)
+    {
+        Poll->Quiet = false;
+        if (Poll->Mode != GPS_APP_POLL_FAST)
+        {
+            GPS_APP_Poll_SetMode(GPS_APP_POLL_FAST, Speed, Accel, MoveRate);
+        }
+        return;
+    }
+
+    if (Poll->Mode != GPS_APP_POLL_FAST)
+    {
+        return;
+    }
+
+    /*
+    ** Between the two sets of thresholds the rate holds; under all the decay
+    ** thresholds long enough it drops back to idle
+    */
+    if (Speed > GPS_APP_POLL_DECAY_SPEED || Accel > GPS_APP_POLL_DECAY_ACCEL || MoveRate > GPS_APP_POLL_DECAY_MOVE_RATE)
+    {
+        Poll->Quiet = false;
+    }
+    else if (!Poll->Quiet)
+    {
+        Poll->Quiet      = true;
+        Poll->QuietStart = Sample->AcquiredTime;
+    }
+    else if (GPS_APP_DeltaUsec(Poll->QuietStart, Sample->AcquiredTime) >= (uint32)GPS_APP_POLL_HOLD_MS * 1000)
+    {
+        GPS_APP_Poll_SetMode(GPS_APP_POLL_IDLE, Speed, Accel, MoveRate);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Close the housekeeping window: effective read rate and bus duty cycle      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Poll_Report(void)
+{
+    GPS_APP_PollData_t *Poll = &GPS_APP_Data.Poll;
+    OS_time_t           Now;
+    uint32              Usec;
+    uint32              BusUs;
+
+    CFE_PSP_GetTime(&Now);
+    Usec  = GPS_APP_DeltaUsec(Poll->WindowStart, Now);
+    BusUs = GPS_APP_Dev_TakeBusUs();
+
+    if (Usec > 0)
+    {
+        Poll->RateHz  = (float)(Poll->Reads * 1.0e6 / Usec);
+        Poll->BusDuty = (float)(BusUs * 100.0 / Usec);
+    }
+
+    Poll->Reads       = 0;
+    Poll->WindowStart = Now;
+}
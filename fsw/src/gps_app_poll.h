@@ -0,0 +1,82 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Adaptive poll rate for the GPS App
+ *
+ * GPS_APP_READ_MID arrives at a fixed scheduler rate. In the idle mode only
+ * every GPS_APP_POLL_IDLE_DIVISOR'th wakeup reads the receiver; in the fast
+ * mode every wakeup does. Each committed fix is checked for speed, and for
+ * change in speed and distance moved since the previous fix, both taken per
+ * second so they mean the same at either rate. Any of them over its raise
+ * threshold switches to the fast mode at once. The poll rate only decays
+ * back to idle after all of them have stayed under their lower decay
+ * thresholds for GPS_APP_POLL_HOLD_MS, so a vehicle near a threshold does not
+ * flip between rates. If GPS_APP_POLL_SET_NAV_RATE is set, each switch also
+ * sends UBX CFG-RATE so the receiver's navigation rate follows the poll rate.
+ */
+
+#ifndef GPS_APP_POLL_H
+#define GPS_APP_POLL_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_sample.h"
+
+/*
+** UBX CFG-RATE framing
+*/
+#define GPS_APP_UBX_CLASS_CFG    0x06
+#define GPS_APP_UBX_ID_CFG_RATE  0x08
+#define GPS_APP_UBX_CFG_RATE_LEN 6
+#define GPS_APP_UBX_TIME_REF_GPS 1
+
+typedef struct
+{
+    uint8  Mode;          /* GPS_APP_POLL_IDLE or _FAST */
+    uint32 Wakeups;       /* Read wakeups since the last read */
+    uint32 ModeChanges;
+    uint32 NavRateErrors; /* CFG-RATE writes that failed */
+
+    /*
+    ** Previous fix, for the dynamics
+    */
+    bool      PrevValid;
+    double    PrevSpeed;
+    double    PrevEcef[3];
+    OS_time_t PrevTime;
+    bool      Quiet;      /* Under every decay threshold since QuietStart */
+    OS_time_t QuietStart;
+
+    /*
+    ** Accumulated since the last housekeeping report
+    */
+    uint32    Reads;
+    OS_time_t WindowStart;
+    float     RateHz;     /* Results of the last report window */
+    float     BusDuty;    /* Percent of the window the uC bus was busy, all tasks */
+} GPS_APP_PollData_t;
+
+void GPS_APP_Poll_Init(void);
+bool GPS_APP_Poll_Due(void);
+void GPS_APP_Poll_Update(const GPS_APP_Sample_t *Sample);
+void GPS_APP_Poll_Report(void);
+
+#endif /* GPS_APP_POLL_H */
@@ -0,0 +1,42 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * One decoded receiver sample, as it moves from acquisition to commit
+ */
+
+#ifndef GPS_APP_SAMPLE_H
+#define GPS_APP_SAMPLE_H
+
+#include "cfe.h"
+
+#define GPS_APP_SAMPLE_BYTES 14 /* Size of one fix read from the uC */
+
+typedef struct
+{
+    float     latitude;
+    float     longitude;
+    float     altitude;
+    uint8     satellites;
+    uint8     spare[3];
+    OS_time_t AcquiredTime; /* When the bus transfer completed */
+} GPS_APP_Sample_t;
+
+#endif /* GPS_APP_SAMPLE_H */
@@ -0,0 +1,198 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Rolling position statistics for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Initialize the statistics and their packet                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Stats_Init(void)
+{
+    memset(&GPS_APP_Data.Stats, 0, sizeof(GPS_APP_Data.Stats));
+
+    CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_Data.StatsTlm.TelemetryHeader), CFE_SB_ValueToMsgId(GPS_APP_STATS_TLM_MID),
+                 sizeof(GPS_APP_Data.StatsTlm));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Recompute the window sums from the ring                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Stats_Resum(GPS_APP_StatsData_t *Stats)
+{
+    uint32 i;
+    uint32 a;
+
+    for (a = 0; a < GPS_APP_STATS_AXES; a++)
+    {
+        Stats->Sum[a]   = 0.0;
+        Stats->SumSq[a] = 0.0;
+    }
+
+    for (i = 0; i < Stats->RingFill; i++)
+    {
+        for (a = 0; a < GPS_APP_STATS_AXES; a++)
+        {
+            Stats->Sum[a] += Stats->Ring[i][a];
+            Stats->SumSq[a] += Stats->Ring[i][a] * Stats->Ring[i][a];
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Add a committed fix to the statistics                                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Stats_Update(const GPS_APP_Sample_t *Sample)
+{
+    GPS_APP_StatsData_t *Stats = &GPS_APP_Data.Stats;
+    double               X[GPS_APP_STATS_AXES];
+    double               Delta;
+    double               Old;
+    uint32               a;
+
+    X[GPS_APP_STATS_LAT] = Sample->latitude;
+    X[GPS_APP_STATS_LON] = Sample->longitude;
+    X[GPS_APP_STATS_ALT] = Sample->altitude;
+
+    if (Stats->Count == 0)
+    {
+        for (a = 0; a < GPS_APP_STATS_AXES; a++)
+        {
+            Stats->Ref[a] = X[a];
+            Stats->Min[a] = X[a];
+            Stats->Max[a] = X[a];
+        }
+    }
+
+    Stats->Count++;
+
+    for (a = 0; a < GPS_APP_STATS_AXES; a++)
+    {
+        Delta = X[a] - Stats->Mean[a];
+        Stats->Mean[a] += Delta / Stats->Count;
+        Stats->M2[a] += Delta * (X[a] - Stats->Mean[a]);
+
+        if (X[a] < Stats->Min[a])
+        {
+            Stats->Min[a] = X[a];
+        }
+        if (X[a] > Stats->Max[a])
+        {
+            Stats->Max[a] = X[a];
+        }
+
+        if (Stats->RingFill == GPS_APP_STATS_WINDOW)
+        {
+            Old = Stats->Ring[Stats->RingNext][a];
+            Stats->Sum[a] -= Old;
+            Stats->SumSq[a] -= Old * Old;
+        }
+
+        Stats->Ring[Stats->RingNext][a] = X[a] - Stats->Ref[a];
+        Stats->Sum[a] += Stats->Ring[Stats->RingNext][a];
+        Stats->SumSq[a] += Stats->Ring[Stats->RingNext][a] * Stats->Ring[Stats->RingNext][a];
+    }
+
+    Stats->RingNext = (Stats->RingNext + 1) % GPS_APP_STATS_WINDOW;
+    if (Stats->RingFill < GPS_APP_STATS_WINDOW)
+    {
+        Stats->RingFill++;
+    }
+    else if (Stats->RingNext == 0)
+    {
+        GPS_APP_Stats_Resum(Stats);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Fill and send the statistics packet                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Stats_Report(void)
+{
+    const GPS_APP_StatsData_t *Stats   = &GPS_APP_Data.Stats;
+    GPS_APP_StatsTlm_Payload_t *Payload = &GPS_APP_Data.StatsTlm.Payload;
+    GPS_APP_AxisStats_t *       Axis;
+    double                      n = Stats->RingFill;
+    double                      Var;
+    uint32                      a;
+
+    Payload->Count      = Stats->Count;
+    Payload->WindowFill = Stats->RingFill;
+
+    for (a = 0; a < GPS_APP_STATS_AXES; a++)
+    {
+        Axis = &Payload->Axis[a];
+
+        Axis->Mean   = Stats->Mean[a];
+        Axis->StdDev = (Stats->Count > 1) ? sqrt(Stats->M2[a] / (Stats->Count - 1)) : 0.0;
+        Axis->Min    = Stats->Min[a];
+        Axis->Max    = Stats->Max[a];
+
+        if (Stats->RingFill > 0)
+        {
+            Axis->WindowMean = Stats->Ref[a] + Stats->Sum[a] / n;
+        }
+        else
+        {
+            Axis->WindowMean = 0.0;
+        }
+
+        Var = 0.0;
+        if (Stats->RingFill > 1)
+        {
+            Var = (Stats->SumSq[a] - Stats->Sum[a] * Stats->Sum[a] / n) / (n - 1.0);
+        }
+        Axis->WindowStdDev = (Var > 0.0) ? sqrt(Var) : 0.0;
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.StatsTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.StatsTlm.TelemetryHeader), true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* GPS reset statistics command                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_ResetStats(const GPS_APP_ResetStatsCmd_t *Msg)
+{
+    memset(&GPS_APP_Data.Stats, 0, sizeof(GPS_APP_Data.Stats));
+
+    GPS_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(GPS_APP_STATS_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: position statistics reset");
+
+    return CFE_SUCCESS;
+}
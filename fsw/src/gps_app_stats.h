@@ -0,0 +1,68 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Rolling position statistics for the GPS App
+ *
+ * Every committed fix updates, in constant time: a Welford mean and variance
+ * and the min/max since the last reset, and the mean and variance over the
+ * last GPS_APP_STATS_WINDOW fixes from running sums over a ring buffer. The
+ * window sums are kept relative to the first fix so the squares don't lose
+ * the scatter to cancellation, and are re-summed from the ring once per
+ * wrap so rounding can't build up. The results go out in a low-rate
+ * statistics packet with housekeeping.
+ */
+
+#ifndef GPS_APP_STATS_H
+#define GPS_APP_STATS_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_sample.h"
+#include "gps_app_platform_cfg.h"
+
+typedef struct
+{
+    /*
+    ** Since the last reset
+    */
+    uint32 Count;
+    double Mean[GPS_APP_STATS_AXES];
+    double M2[GPS_APP_STATS_AXES]; /* Sum of squared deviations from the running mean */
+    double Min[GPS_APP_STATS_AXES];
+    double Max[GPS_APP_STATS_AXES];
+
+    /*
+    ** Sliding window, values relative to Ref
+    */
+    double Ref[GPS_APP_STATS_AXES];
+    double Ring[GPS_APP_STATS_WINDOW][GPS_APP_STATS_AXES];
+    uint32 RingNext;
+    uint32 RingFill;
+    double Sum[GPS_APP_STATS_AXES];
+    double SumSq[GPS_APP_STATS_AXES];
+} GPS_APP_StatsData_t;
+
+void  GPS_APP_Stats_Init(void);
+void  GPS_APP_Stats_Update(const GPS_APP_Sample_t *Sample);
+void  GPS_APP_Stats_Report(void);
+int32 GPS_APP_ResetStats(const GPS_APP_ResetStatsCmd_t *Msg);
+
+#endif /* GPS_APP_STATS_H */
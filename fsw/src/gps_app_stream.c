@@ -0,0 +1,404 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Multi-rate output streams for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/*
+** Encoded size of each field, by encoding and field bit
+*/
+static const uint8 GPS_APP_StreamFieldSize[GPS_APP_STREAM_ENCODINGS][GPS_APP_STREAM_NUM_FIELDS] = {
+    /* Lat Lon Alt Sats Speed Course VRate ENU ECEF */
+    {8, 8, 8, 1, 4, 4, 4, 24, 24}, /* GPS_APP_STREAM_FULL */
+    {4, 4, 4, 1, 2, 2, 2, 12, 12}, /* GPS_APP_STREAM_COMPACT */
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Register and load the output stream table                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Stream_Init(void)
+{
+    int32 status;
+
+    memset(&GPS_APP_Data.Stream, 0, sizeof(GPS_APP_Data.Stream));
+
+    status = CFE_TBL_Register(&GPS_APP_Data.Stream.TblHandle, GPS_APP_STREAM_TBL_NAME, sizeof(GPS_APP_StreamTbl_t),
+                              CFE_TBL_OPT_DEFAULT, GPS_APP_Stream_ValidateTbl);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("GPS App: Error Registering Stream Table, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    /*
+    ** A missing table only means no streams are sent, the packets are set
+    ** up on the first fix after a good load
+    */
+    status = CFE_TBL_Load(GPS_APP_Data.Stream.TblHandle, CFE_TBL_SRC_FILE, GPS_APP_STREAM_TBL_FILE);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(GPS_APP_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "GPS: error loading stream table %s, RC = 0x%08lX", GPS_APP_STREAM_TBL_FILE,
+                          (unsigned long)status);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Validate an output stream table image                                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Stream_ValidateTbl(void *TblData)
+{
+    const GPS_APP_StreamTbl_t *  Tbl = TblData;
+    const GPS_APP_StreamEntry_t *Entry;
+    uint32                       s;
+
+    for (s = 0; s < GPS_APP_STREAM_MAX; s++)
+    {
+        Entry = &Tbl->Stream[s];
+
+        if (Entry->MsgId == 0)
+        {
+            continue;
+        }
+
+        if (Entry->Divisor == 0 || Entry->FieldMask == 0 || (Entry->FieldMask & ~GPS_APP_STREAM_ALL_FIELDS) != 0 ||
+            Entry->Encoding >= GPS_APP_STREAM_ENCODINGS)
+        {
+            CFE_EVS_SendEvent(GPS_APP_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "GPS: stream table entry %u (MID 0x%04X) invalid, divisor = %u, fields = 0x%X, "
+                              "encoding = %u",
+                              (unsigned int)s, (unsigned int)Entry->MsgId, (unsigned int)Entry->Divisor,
+                              (unsigned int)Entry->FieldMask, (unsigned int)Entry->Encoding);
+            return CFE_STATUS_VALIDATION_FAILURE;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Give table services a chance to validate and apply pending loads           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Stream_Manage(void)
+{
+    CFE_TBL_Manage(GPS_APP_Data.Stream.TblHandle);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Set up the packets for a newly loaded table and restart the counts         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Stream_Configure(const GPS_APP_StreamTbl_t *Tbl)
+{
+    GPS_APP_StreamData_t *Stream = &GPS_APP_Data.Stream;
+    uint32                Count  = 0;
+    uint32                s;
+
+    Stream->Ticks = 0;
+    memset(Stream->Stats, 0, sizeof(Stream->Stats));
+
+    for (s = 0; s < GPS_APP_STREAM_MAX; s++)
+    {
+        if (Tbl->Stream[s].MsgId == 0)
+        {
+            continue;
+        }
+
+        CFE_MSG_Init(CFE_MSG_PTR(Stream->Pkt[s].TelemetryHeader), CFE_SB_ValueToMsgId(Tbl->Stream[s].MsgId),
+                     sizeof(Stream->Pkt[s]));
+        Stream->Pkt[s].Payload.FieldMask = Tbl->Stream[s].FieldMask;
+        Stream->Pkt[s].Payload.Encoding  = Tbl->Stream[s].Encoding;
+
+        Stream->Stats[s].MsgId   = Tbl->Stream[s].MsgId;
+        Stream->Stats[s].Divisor = Tbl->Stream[s].Divisor;
+        Count++;
+    }
+
+    CFE_EVS_SendEvent(GPS_APP_STREAM_INF_EID, CFE_EVS_EventType_INFORMATION, "GPS: stream table loaded, %u streams",
+                      (unsigned int)Count);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Scale to a fixed point int32, saturating                                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 GPS_APP_Stream_Fixed(double Value, double Scale)
+{
+    double Scaled = Value * Scale;
+
+    if (Scaled >= (double)INT32_MAX)
+    {
+        return INT32_MAX;
+    }
+    if (Scaled <= (double)INT32_MIN)
+    {
+        return INT32_MIN;
+    }
+
+    return (int32)lround(Scaled);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Encode each field in Mask from the current fix into the scratch    */
+/*         area for one encoding.                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Stream_Encode(uint8 Encoding, uint32 Mask)
+{
+    const GPS_APP_GeoTlm_Payload_t *Geo = &GPS_APP_Data.GeoTlm.Payload;
+    const GPS_APP_VelData_t *       Vel = &GPS_APP_Data.Vel;
+    bool                            Full = (Encoding == GPS_APP_STREAM_FULL);
+    uint8 *                         Out;
+    double                          D[3];
+    float                           F;
+    int32                           I[3];
+    uint16                          U16;
+    int16                           I16;
+    uint32                          f;
+
+    while (Mask != 0)
+    {
+        f = __builtin_ctz(Mask);
+        Mask &= Mask - 1;
+
+        Out = GPS_APP_Data.Stream.Encoded[Encoding][f];
+
+        switch (1U << f)
+        {
+            case GPS_APP_STREAM_LAT:
+            case GPS_APP_STREAM_LON:
+                D[0] = ((1U << f) == GPS_APP_STREAM_LAT) ? Geo->Latitude : Geo->Longitude;
+                if (Full)
+                {
+                    memcpy(Out, &D[0], sizeof(D[0]));
+                }
+                else
+                {
+                    I[0] = GPS_APP_Stream_Fixed(D[0], 1.0e7);
+                    memcpy(Out, &I[0], sizeof(I[0]));
+                }
+                break;
+
+            case GPS_APP_STREAM_ALT:
+                if (Full)
+                {
+                    memcpy(Out, &Geo->Altitude, sizeof(Geo->Altitude));
+                }
+                else
+                {
+                    I[0] = GPS_APP_Stream_Fixed(Geo->Altitude, 1000.0);
+                    memcpy(Out, &I[0], sizeof(I[0]));
+                }
+                break;
+
+            case GPS_APP_STREAM_SATS:
+                Out[0] = GPS_APP_Data.satellites;
+                break;
+
+            case GPS_APP_STREAM_SPEED:
+                if (Full)
+                {
+                    memcpy(Out, &Vel->GroundSpeed, sizeof(Vel->GroundSpeed));
+                }
+                else
+                {
+                    F   = Vel->GroundSpeed * 100.0f;
+                    U16 = (F >= (float)UINT16_MAX) ? UINT16_MAX : (uint16)lroundf(F);
+                    memcpy(Out, &U16, sizeof(U16));
+                }
+                break;
+
+            case GPS_APP_STREAM_COURSE:
+                if (Full)
+                {
+                    memcpy(Out, &Vel->CourseDeg, sizeof(Vel->CourseDeg));
+                }
+                else
+                {
+                    memcpy(Out, &Vel->CourseCdeg, sizeof(Vel->CourseCdeg));
+                }
+                break;
+
+            case GPS_APP_STREAM_VRATE:
+                if (Full)
+                {
+                    memcpy(Out, &Vel->VertRate, sizeof(Vel->VertRate));
+                }
+                else
+                {
+                    I16 = Vel->VertRateCms;
+                    memcpy(Out, &I16, sizeof(I16));
+                }
+                break;
+
+            case GPS_APP_STREAM_ENU:
+            case GPS_APP_STREAM_ECEF:
+                if ((1U << f) == GPS_APP_STREAM_ENU)
+                {
+                    D[0] = Geo->East;
+                    D[1] = Geo->North;
+                    D[2] = Geo->Up;
+                }
+                else
+                {
+                    D[0] = Geo->EcefX;
+                    D[1] = Geo->EcefY;
+                    D[2] = Geo->EcefZ;
+                }
+                if (Full)
+                {
+                    memcpy(Out, D, sizeof(D));
+                }
+                else
+                {
+                    I[0] = GPS_APP_Stream_Fixed(D[0], 100.0);
+                    I[1] = GPS_APP_Stream_Fixed(D[1], 100.0);
+                    I[2] = GPS_APP_Stream_Fixed(D[2], 100.0);
+                    memcpy(Out, I, sizeof(I));
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         One acquisition tick: encode the fields the due streams need once  */
+/*         per encoding, then copy them into each due packet and send it.     */
+/*         Called for every committed fix.                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Stream_Run(void)
+{
+    GPS_APP_StreamData_t *       Stream = &GPS_APP_Data.Stream;
+    GPS_APP_StreamTbl_t *        TblPtr = NULL;
+    const GPS_APP_StreamEntry_t *Entry;
+    GPS_APP_StreamStats_t *      Stats;
+    uint32                       Need[GPS_APP_STREAM_ENCODINGS] = {0};
+    uint32                       Due                            = 0;
+    uint32                       Mask;
+    uint32                       Size;
+    uint32                       s;
+    uint32                       f;
+    uint8 *                      Data;
+    OS_time_t                    StartTime;
+    OS_time_t                    EndTime;
+    int32                        status;
+
+    CFE_ES_PerfLogEntry(GPS_APP_STREAM_PERF_ID);
+
+    status = CFE_TBL_GetAddress((void **)&TblPtr, Stream->TblHandle);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        GPS_APP_Stream_Configure(TblPtr);
+    }
+    else if (status != CFE_SUCCESS)
+    {
+        CFE_ES_PerfLogExit(GPS_APP_STREAM_PERF_ID);
+        return;
+    }
+
+    for (s = 0; s < GPS_APP_STREAM_MAX; s++)
+    {
+        Entry = &TblPtr->Stream[s];
+        if (Entry->MsgId != 0 && Stream->Ticks % Entry->Divisor == 0)
+        {
+            Due |= (1U << s);
+            Need[Entry->Encoding] |= Entry->FieldMask;
+        }
+    }
+    Stream->Ticks++;
+
+    CFE_PSP_GetTime(&StartTime);
+    for (s = 0; s < GPS_APP_STREAM_ENCODINGS; s++)
+    {
+        if (Need[s] != 0)
+        {
+            GPS_APP_Stream_Encode(s, Need[s]);
+        }
+    }
+    CFE_PSP_GetTime(&EndTime);
+    Stream->EncodeUs = GPS_APP_DeltaUsec(StartTime, EndTime);
+
+    while (Due != 0)
+    {
+        s = __builtin_ctz(Due);
+        Due &= Due - 1;
+
+        Entry = &TblPtr->Stream[s];
+        Stats = &Stream->Stats[s];
+
+        CFE_PSP_GetTime(&StartTime);
+
+        Data = Stream->Pkt[s].Payload.Data;
+        Size = 0;
+        Mask = Entry->FieldMask;
+        while (Mask != 0)
+        {
+            f = __builtin_ctz(Mask);
+            Mask &= Mask - 1;
+
+            memcpy(&Data[Size], Stream->Encoded[Entry->Encoding][f], GPS_APP_StreamFieldSize[Entry->Encoding][f]);
+            Size += GPS_APP_StreamFieldSize[Entry->Encoding][f];
+        }
+
+        CFE_MSG_SetSize(CFE_MSG_PTR(Stream->Pkt[s].TelemetryHeader),
+                        offsetof(GPS_APP_StreamTlm_t, Payload.Data) + Size);
+
+        CFE_PSP_GetTime(&EndTime);
+        Stats->BuildUs = GPS_APP_DeltaUsec(StartTime, EndTime);
+        if (Stats->BuildUs > Stats->BuildMaxUs)
+        {
+            Stats->BuildMaxUs = Stats->BuildUs;
+        }
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(Stream->Pkt[s].TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(Stream->Pkt[s].TelemetryHeader), true);
+        Stats->Packets++;
+    }
+
+    CFE_TBL_ReleaseAddress(Stream->TblHandle);
+
+    CFE_ES_PerfLogExit(GPS_APP_STREAM_PERF_ID);
+}
@@ -0,0 +1,79 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Multi-rate output streams for the GPS App
+ *
+ * A cFE table lists up to GPS_APP_STREAM_MAX streams, each with its own MID,
+ * set of fields, encoding and rate divisor. Every committed fix is one tick;
+ * a stream is sent on the ticks that are a multiple of its divisor. On each
+ * tick the fields wanted by any due stream are encoded once per encoding,
+ * and each due packet is then assembled by copying its fields out of that
+ * scratch area, so a field shared by several streams is only converted once.
+ */
+
+#ifndef GPS_APP_STREAM_H
+#define GPS_APP_STREAM_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_platform_cfg.h"
+
+#define GPS_APP_STREAM_FIELD_BYTES 24 /* Largest encoded field, three doubles */
+
+/*
+** Table definition
+*/
+typedef struct
+{
+    uint16 MsgId;     /* Telemetry MID, 0 for an unused entry */
+    uint16 Divisor;   /* Send on every Nth fix */
+    uint32 FieldMask; /* GPS_APP_STREAM_... fields */
+    uint8  Encoding;  /* GPS_APP_STREAM_FULL or _COMPACT */
+    uint8  spare[3];
+} GPS_APP_StreamEntry_t;
+
+typedef struct
+{
+    GPS_APP_StreamEntry_t Stream[GPS_APP_STREAM_MAX];
+} GPS_APP_StreamTbl_t;
+
+typedef struct
+{
+    CFE_TBL_Handle_t TblHandle;
+
+    uint32 Ticks; /* Fixes since the table was loaded */
+
+    /*
+    ** Fields encoded on the current tick
+    */
+    uint8 Encoded[GPS_APP_STREAM_ENCODINGS][GPS_APP_STREAM_NUM_FIELDS][GPS_APP_STREAM_FIELD_BYTES];
+
+    GPS_APP_StreamTlm_t   Pkt[GPS_APP_STREAM_MAX];
+    GPS_APP_StreamStats_t Stats[GPS_APP_STREAM_MAX];
+    uint32                EncodeUs;
+} GPS_APP_StreamData_t;
+
+int32 GPS_APP_Stream_Init(void);
+int32 GPS_APP_Stream_ValidateTbl(void *TblData);
+void  GPS_APP_Stream_Manage(void);
+void  GPS_APP_Stream_Run(void);
+
+#endif /* GPS_APP_STREAM_H */
@@ -0,0 +1,321 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Satellite table for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include "gps_app_events.h"
+#include "gps_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Initialize the satellite table and its packet                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Sv_Init(void)
+{
+    memset(&GPS_APP_Data.Sv, 0, sizeof(GPS_APP_Data.Sv));
+    memset(GPS_APP_Data.Sv.SentSlot, GPS_APP_SV_NO_SLOT, sizeof(GPS_APP_Data.Sv.SentSlot));
+
+    CFE_MSG_Init(CFE_MSG_PTR(GPS_APP_Data.SvTlm.TelemetryHeader), CFE_SB_ValueToMsgId(GPS_APP_SV_TLM_MID),
+                 sizeof(GPS_APP_Data.SvTlm));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Decode a NAV-SVINFO frame into the table, false if it is not a valid one   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Sv_Decode(const uint8 *Frame, uint32 Size, GPS_APP_SvTable_t *Table)
+{
+    const uint8 *Payload = &Frame[6];
+    const uint8 *Block;
+    uint32       Len;
+    uint32       NumCh;
+    uint32       i;
+    uint8        CkA = 0;
+    uint8        CkB = 0;
+
+    if (Frame[0] != GPS_APP_UBX_SYNC1 || Frame[1] != GPS_APP_UBX_SYNC2 || Frame[2] != GPS_APP_UBX_CLASS_NAV ||
+        Frame[3] != GPS_APP_UBX_ID_NAV_SVINFO)
+    {
+        return false;
+    }
+
+    Len = Frame[4] | (Frame[5] << 8);
+    if (Len < GPS_APP_UBX_SVINFO_HDR_LEN || GPS_APP_UBX_FRAME_LEN(Len) > Size)
+    {
+        return false;
+    }
+
+    for (i = 2; i < 6 + Len; i++)
+    {
+        CkA += Frame[i];
+        CkB += CkA;
+    }
+    if (CkA != Frame[6 + Len] || CkB != Frame[7 + Len])
+    {
+        return false;
+    }
+
+    NumCh = Payload[4];
+    if (GPS_APP_UBX_SVINFO_HDR_LEN + NumCh * GPS_APP_UBX_SVINFO_BLOCK_LEN > Len)
+    {
+        return false;
+    }
+
+    /*
+    ** The whole frame checked out; keep the first GPS_APP_SV_MAX channels if
+    ** the receiver tracks more
+    */
+    if (NumCh > GPS_APP_SV_MAX)
+    {
+        NumCh = GPS_APP_SV_MAX;
+    }
+
+    Table->Itow  = Payload[0] | (Payload[1] << 8) | (Payload[2] << 16) | ((uint32)Payload[3] << 24);
+    Table->Count = NumCh;
+
+    for (i = 0; i < NumCh; i++)
+    {
+        Block             = &Payload[GPS_APP_UBX_SVINFO_HDR_LEN + i * GPS_APP_UBX_SVINFO_BLOCK_LEN];
+        Table->SvId[i]    = Block[1];
+        Table->Flags[i]   = Block[2];
+        Table->Quality[i] = Block[3];
+        Table->Cno[i]     = Block[4];
+        Table->Elev[i]    = (int8)Block[5];
+        Table->Azim[i]    = (int16)(Block[6] | (Block[7] << 8));
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Read the NAV-SVINFO frame into Frame. The UBX header comes first,  */
+/*         then the register is read again for the frame at the length the    */
+/*         header gives, so only the channels reported cross the bus. Size    */
+/*         is the number of bytes read.                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int GPS_APP_Sv_ReadFrame(uint8 *Frame, uint32 *Size)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    uint32    Len;
+    int       rc;
+
+    CFE_PSP_GetTime(&StartTime);
+    rc = uC_read_reg(UC_SVINFO_REGISTER, Frame, GPS_APP_UBX_HDR_LEN);
+    CFE_PSP_GetTime(&EndTime);
+    GPS_APP_Dev_AccountBus(GPS_APP_DeltaUsec(StartTime, EndTime));
+
+    if (rc != 0)
+    {
+        return rc;
+    }
+
+    Len = Frame[4] | (Frame[5] << 8);
+    if (Frame[0] != GPS_APP_UBX_SYNC1 || Frame[1] != GPS_APP_UBX_SYNC2 || Frame[2] != GPS_APP_UBX_CLASS_NAV ||
+        Frame[3] != GPS_APP_UBX_ID_NAV_SVINFO || GPS_APP_UBX_FRAME_LEN(Len) > GPS_APP_SV_FRAME_MAX)
+    {
+        return -1;
+    }
+
+    *Size = GPS_APP_UBX_FRAME_LEN(Len);
+
+    CFE_PSP_GetTime(&StartTime);
+    rc = uC_read_reg(UC_SVINFO_REGISTER, Frame, *Size);
+    CFE_PSP_GetTime(&EndTime);
+    GPS_APP_Dev_AccountBus(GPS_APP_DeltaUsec(StartTime, EndTime));
+
+    return rc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* True if an SV moved far enough from what was last sent to send it again    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Sv_Changed(const GPS_APP_SvTable_t *Cur, uint32 i, const GPS_APP_SvTable_t *Sent, uint32 s)
+{
+    int32 DCno = (int32)Cur->Cno[i] - (int32)Sent->Cno[s];
+
+    return (DCno >= GPS_APP_SV_CNO_DEADBAND || DCno <= -GPS_APP_SV_CNO_DEADBAND || Cur->Elev[i] != Sent->Elev[s] ||
+            Cur->Azim[i] != Sent->Azim[s] || Cur->Flags[i] != Sent->Flags[s] ||
+            Cur->Quality[i] != Sent->Quality[s]);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Copy SV i of the current table into slot s of the sent table               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Sv_Store(GPS_APP_SvTable_t *Sent, uint32 s, const GPS_APP_SvTable_t *Cur, uint32 i)
+{
+    Sent->SvId[s]    = Cur->SvId[i];
+    Sent->Cno[s]     = Cur->Cno[i];
+    Sent->Elev[s]    = Cur->Elev[i];
+    Sent->Azim[s]    = Cur->Azim[i];
+    Sent->Flags[s]   = Cur->Flags[i];
+    Sent->Quality[s] = Cur->Quality[i];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Add SV i of the current table to the packet                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Sv_Encode(GPS_APP_SvEntry_t *Entry, const GPS_APP_SvTable_t *Table, uint32 i, uint8 Change)
+{
+    Entry->SvId    = Table->SvId[i];
+    Entry->Cno     = Table->Cno[i];
+    Entry->Elev    = Table->Elev[i];
+    Entry->Quality = Table->Quality[i];
+    Entry->Azim    = Table->Azim[i];
+    Entry->Flags   = Table->Flags[i];
+    Entry->Change  = Change;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Satellite packet request: read and decode NAV-SVINFO, then send    */
+/*         the SVs that were lost, are new or changed since last sent.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Sv_Send(const CFE_MSG_CommandHeader_t *Msg)
+{
+    GPS_APP_SvData_t *       Sv      = &GPS_APP_Data.Sv;
+    GPS_APP_SvTable_t *      Cur     = &Sv->Current;
+    GPS_APP_SvTable_t *      Sent    = &Sv->Sent;
+    GPS_APP_SvTlm_Payload_t *Payload = &GPS_APP_Data.SvTlm.Payload;
+    uint8                    Tracked[256];
+    uint32                   n = 0;
+    uint32                   i;
+    uint32                   s;
+    uint32                   Last;
+    uint32                   FrameSize = 0;
+    size_t                   Size;
+
+    /*
+    ** The frame can change between the two reads; a longer one then fails
+    ** the length check in the decode and counts as an error
+    */
+    if (GPS_APP_Sv_ReadFrame(Sv->Frame, &FrameSize) != 0 || !GPS_APP_Sv_Decode(Sv->Frame, FrameSize, Cur))
+    {
+        Sv->Errors++;
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    Payload->Keyframe = (Sv->Sequence % GPS_APP_SV_KEYFRAME_PERIOD) == 0;
+    if (Payload->Keyframe)
+    {
+        Sent->Count = 0;
+        memset(Sv->SentSlot, GPS_APP_SV_NO_SLOT, sizeof(Sv->SentSlot));
+    }
+
+    memset(Tracked, 0, sizeof(Tracked));
+    for (i = 0; i < Cur->Count; i++)
+    {
+        Tracked[Cur->SvId[i]] = 1;
+    }
+
+    /*
+    ** Lost SVs. Removal moves the last slot into the hole, so walk down.
+    */
+    for (s = Sent->Count; s-- > 0;)
+    {
+        if (!Tracked[Sent->SvId[s]])
+        {
+            GPS_APP_Sv_Encode(&Payload->Entries[n++], Sent, s, GPS_APP_SV_CHANGE_LOST);
+
+            Sv->SentSlot[Sent->SvId[s]] = GPS_APP_SV_NO_SLOT;
+            Last                        = --Sent->Count;
+            if (s != Last)
+            {
+                GPS_APP_Sv_Store(Sent, s, Sent, Last);
+                Sv->SentSlot[Sent->SvId[s]] = s;
+            }
+        }
+    }
+
+    /*
+    ** New and changed SVs
+    */
+    for (i = 0; i < Cur->Count; i++)
+    {
+        s = Sv->SentSlot[Cur->SvId[i]];
+        if (s == GPS_APP_SV_NO_SLOT)
+        {
+            s                           = Sent->Count++;
+            Sv->SentSlot[Cur->SvId[i]] = s;
+        }
+        else if (!GPS_APP_Sv_Changed(Cur, i, Sent, s))
+        {
+            continue;
+        }
+
+        GPS_APP_Sv_Store(Sent, s, Cur, i);
+        GPS_APP_Sv_Encode(&Payload->Entries[n++], Cur, i, GPS_APP_SV_CHANGE_UPDATE);
+    }
+
+    Payload->Itow       = Cur->Itow;
+    Payload->Sequence   = Sv->Sequence++;
+    Payload->NumSv      = Cur->Count;
+    Payload->NumEntries = n;
+
+    /*
+    ** Only the entries in use go out
+    */
+    Size = offsetof(GPS_APP_SvTlm_t, Payload.Entries) + n * sizeof(GPS_APP_SvEntry_t);
+    CFE_MSG_SetSize(CFE_MSG_PTR(GPS_APP_Data.SvTlm.TelemetryHeader), Size);
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(GPS_APP_Data.SvTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(GPS_APP_Data.SvTlm.TelemetryHeader), true);
+
+    Sv->EntriesSent += n;
+    Sv->LastPktBytes = Size;
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SVs used in the navigation solution, from the last table read              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint8 GPS_APP_Sv_UsedCount(void)
+{
+    const GPS_APP_SvTable_t *Cur  = &GPS_APP_Data.Sv.Current;
+    uint8                    Used = 0;
+    uint32                   i;
+
+    for (i = 0; i < Cur->Count; i++)
+    {
+        Used += (Cur->Flags[i] & GPS_APP_SV_FLAG_USED) != 0;
+    }
+
+    return Used;
+}
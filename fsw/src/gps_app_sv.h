@@ -0,0 +1,89 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Satellite table for the GPS App
+ *
+ * On each GPS_APP_SEND_SV_MID request the app reads the header of the
+ * receiver's last UBX NAV-SVINFO frame from the uC, then reads the frame again
+ * at the length the header gives, so the bus only carries the channels the
+ * receiver reported. It checks the frame whole and decodes the first
+ * GPS_APP_SV_MAX channels into a fixed-capacity table held as
+ * structure-of-arrays, one array per field.
+ * The satellite packet only carries the entries that changed since they were
+ * last sent (C/N0 beyond a deadband, any other field, new or lost SVs); every
+ * GPS_APP_SV_KEYFRAME_PERIOD packets it carries the whole table instead, so
+ * the ground can resynchronize after a lost packet.
+ */
+
+#ifndef GPS_APP_SV_H
+#define GPS_APP_SV_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_platform_cfg.h"
+
+/*
+** UBX NAV-SVINFO framing
+*/
+#define GPS_APP_UBX_CLASS_NAV        0x01
+#define GPS_APP_UBX_ID_NAV_SVINFO    0x30
+#define GPS_APP_UBX_SVINFO_HDR_LEN   8  /* iTOW, numCh, globalFlags, reserved */
+#define GPS_APP_UBX_SVINFO_BLOCK_LEN 12 /* Per channel */
+#define GPS_APP_UBX_HDR_LEN          6  /* sync, class, id, length */
+#define GPS_APP_SV_FRAME_MAX \
+    (GPS_APP_UBX_HDR_LEN + GPS_APP_UBX_SVINFO_HDR_LEN + GPS_APP_SV_RX_MAX_CH * GPS_APP_UBX_SVINFO_BLOCK_LEN + 2)
+
+#define GPS_APP_SV_FLAG_USED 0x01 /* NAV-SVINFO flags: used in the navigation solution */
+#define GPS_APP_SV_NO_SLOT   0xFF
+
+/*
+** Satellite table, structure-of-arrays
+*/
+typedef struct
+{
+    uint32 Itow;
+    uint8  Count;
+    uint8  SvId[GPS_APP_SV_MAX];
+    uint8  Cno[GPS_APP_SV_MAX];
+    int8   Elev[GPS_APP_SV_MAX];
+    int16  Azim[GPS_APP_SV_MAX];
+    uint8  Flags[GPS_APP_SV_MAX];
+    uint8  Quality[GPS_APP_SV_MAX];
+} GPS_APP_SvTable_t;
+
+typedef struct
+{
+    GPS_APP_SvTable_t Current;
+    GPS_APP_SvTable_t Sent;           /* As last sent, per SV */
+    uint8             SentSlot[256];  /* SvId to its slot in Sent, GPS_APP_SV_NO_SLOT if none */
+    uint8             Frame[GPS_APP_SV_FRAME_MAX];
+
+    uint16 Sequence;
+    uint32 Errors;        /* Failed reads and frames that did not decode */
+    uint32 EntriesSent;
+    uint32 LastPktBytes;
+} GPS_APP_SvData_t;
+
+void  GPS_APP_Sv_Init(void);
+int32 GPS_APP_Sv_Send(const CFE_MSG_CommandHeader_t *Msg);
+uint8 GPS_APP_Sv_UsedCount(void);
+
+#endif /* GPS_APP_SV_H */
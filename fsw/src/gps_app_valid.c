@@ -0,0 +1,144 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Fix validation for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app.h"
+
+#define GPS_APP_VALID_DEG2RAD (M_PI / 180.0)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Initialize the validation stage                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Valid_Init(void)
+{
+    memset(&GPS_APP_Data.Valid, 0, sizeof(GPS_APP_Data.Valid));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True if the fix is no further from the last accepted one than the  */
+/*         vehicle could have moved since. Distance on a sphere is plenty     */
+/*         for a plausibility bound, and is compared squared.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool GPS_APP_Valid_JumpOk(const GPS_APP_ValidData_t *Valid, const GPS_APP_Sample_t *Sample)
+{
+    double Dt;
+    double DLon;
+    double E, N, U;
+    double Limit;
+
+    Dt = GPS_APP_DeltaUsec(Valid->LastTime, Sample->AcquiredTime) / 1.0e6;
+
+    DLon = Sample->longitude - Valid->LastLon;
+    if (DLon > 180.0)
+    {
+        DLon -= 360.0;
+    }
+    else if (DLon < -180.0)
+    {
+        DLon += 360.0;
+    }
+
+    E = DLon * GPS_APP_VALID_DEG2RAD * GPS_APP_GEO_A * cos(Valid->LastLat * GPS_APP_VALID_DEG2RAD);
+    N = (Sample->latitude - Valid->LastLat) * GPS_APP_VALID_DEG2RAD * GPS_APP_GEO_A;
+    U = Sample->altitude - Valid->LastAlt;
+
+    Limit = GPS_APP_VALID_MAX_SPEED * Dt + GPS_APP_VALID_JUMP_MARGIN_M;
+
+    return (E * E + N * N + U * U) <= Limit * Limit;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Checks that need nothing but the sample itself. Returns the first  */
+/*         reject reason, or GPS_APP_VALID_PASS. Keeps no state, so any task  */
+/*         can call it.                                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 GPS_APP_Valid_Screen(const GPS_APP_Sample_t *Sample)
+{
+    if (!isfinite(Sample->latitude) || !isfinite(Sample->longitude) || !isfinite(Sample->altitude))
+    {
+        return GPS_APP_VALID_NOT_FINITE;
+    }
+
+    if (Sample->latitude < -90.0f || Sample->latitude > 90.0f || Sample->longitude < -180.0f ||
+        Sample->longitude > 180.0f || Sample->altitude < GPS_APP_VALID_MIN_ALT_M ||
+        Sample->altitude > GPS_APP_VALID_MAX_ALT_M)
+    {
+        return GPS_APP_VALID_RANGE;
+    }
+
+    if (Sample->satellites < GPS_APP_VALID_MIN_SATELLITES)
+    {
+        return GPS_APP_VALID_SATELLITES;
+    }
+
+    return GPS_APP_VALID_PASS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Check a sample before it is committed. Returns false, and counts   */
+/*         the reason, if it must not be used.                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool GPS_APP_Valid_Check(const GPS_APP_Sample_t *Sample)
+{
+    GPS_APP_ValidData_t *Valid = &GPS_APP_Data.Valid;
+    int32                Reason;
+
+    Reason = GPS_APP_Valid_Screen(Sample);
+    if (Reason == GPS_APP_VALID_PASS && Valid->LastValid && Valid->JumpRun < GPS_APP_VALID_JUMP_RESYNC &&
+        !GPS_APP_Valid_JumpOk(Valid, Sample))
+    {
+        Reason = GPS_APP_VALID_JUMP;
+        Valid->JumpRun++;
+    }
+
+    if (Reason != GPS_APP_VALID_PASS)
+    {
+        Valid->Rejects[Reason]++;
+        return false;
+    }
+
+    Valid->LastValid = true;
+    Valid->LastLat   = Sample->latitude;
+    Valid->LastLon   = Sample->longitude;
+    Valid->LastAlt   = Sample->altitude;
+    Valid->LastTime  = Sample->AcquiredTime;
+    Valid->JumpRun   = 0;
+    Valid->Accepted++;
+
+    return true;
+}
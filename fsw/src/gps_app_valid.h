@@ -0,0 +1,71 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Fix validation for the GPS App
+ *
+ * Every sample is checked before it is committed. A sample is rejected if
+ * any field is NaN or infinite, if it is out of range, if too few satellites
+ * were used, or if it moved further from the last accepted fix than the
+ * vehicle could have in the time between them. A rejected sample never
+ * reaches GPS_APP_Data, so it is never published, and it is counted under
+ * the first check it failed. After GPS_APP_VALID_JUMP_RESYNC jump rejects in
+ * a row the next fix is accepted as the new anchor, so one bad fix that got
+ * through cannot lock out every good fix after it. The checks that need no
+ * anchor are also available on their own, for the burst capture task.
+ */
+
+#ifndef GPS_APP_VALID_H
+#define GPS_APP_VALID_H
+
+#include "cfe.h"
+#include "gps_app_sample.h"
+
+/*
+** Reject reasons, in the order they are checked
+*/
+#define GPS_APP_VALID_NOT_FINITE  0
+#define GPS_APP_VALID_RANGE       1
+#define GPS_APP_VALID_SATELLITES  2
+#define GPS_APP_VALID_JUMP        3
+#define GPS_APP_VALID_NUM_REASONS 4
+#define GPS_APP_VALID_PASS        (-1)
+
+typedef struct
+{
+    /*
+    ** Last accepted fix, the anchor for the jump check
+    */
+    bool      LastValid;
+    double    LastLat;
+    double    LastLon;
+    double    LastAlt;
+    OS_time_t LastTime;
+    uint32    JumpRun; /* Jump rejects since the last accepted fix */
+
+    uint32 Accepted;
+    uint32 Rejects[GPS_APP_VALID_NUM_REASONS];
+} GPS_APP_ValidData_t;
+
+void  GPS_APP_Valid_Init(void);
+int32 GPS_APP_Valid_Screen(const GPS_APP_Sample_t *Sample);
+bool  GPS_APP_Valid_Check(const GPS_APP_Sample_t *Sample);
+
+#endif /* GPS_APP_VALID_H */
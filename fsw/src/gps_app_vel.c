@@ -0,0 +1,180 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Velocity stage for the GPS App.
+ */
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "gps_app.h"
+
+#define GPS_APP_VEL_DEG2RAD (M_PI / 180.0)
+#define GPS_APP_VEL_RAD2DEG (180.0 / M_PI)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Initialize the velocity stage                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Vel_Init(void)
+{
+    memset(&GPS_APP_Data.Vel, 0, sizeof(GPS_APP_Data.Vel));
+    GPS_APP_Data.Vel.Source = GPS_APP_VEL_SOURCE_NONE;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Speed, course and vertical rate from the smoothed velocity                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void GPS_APP_Vel_Outputs(GPS_APP_VelData_t *Vel)
+{
+    double Speed  = sqrt(Vel->VelE * Vel->VelE + Vel->VelN * Vel->VelN);
+    double Course;
+    double Rate;
+
+    Vel->GroundSpeed = Speed;
+    Vel->VertRate    = Vel->VelU;
+
+    /*
+    ** Direction is noise when barely moving, keep the last course
+    */
+    if (Speed >= GPS_APP_VEL_MIN_COURSE_SPEED)
+    {
+        Course = atan2(Vel->VelE, Vel->VelN) * GPS_APP_VEL_RAD2DEG;
+        if (Course < 0.0)
+        {
+            Course += 360.0;
+        }
+        Vel->CourseDeg  = Course;
+        Vel->CourseCdeg = (uint16)(Course * 100.0) % 36000;
+    }
+
+    Rate = Vel->VelU * 100.0;
+    if (Rate > INT16_MAX)
+    {
+        Rate = INT16_MAX;
+    }
+    else if (Rate < INT16_MIN)
+    {
+        Rate = INT16_MIN;
+    }
+    Vel->VertRateCms = (int16)lround(Rate);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Difference a committed fix against the previous one and smooth     */
+/*         the result. A gap longer than GPS_APP_VEL_MAX_GAP_MS, or a fix     */
+/*         with no time step, starts over from this fix.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void GPS_APP_Vel_Update(const GPS_APP_Sample_t *Sample)
+{
+    GPS_APP_VelData_t *Vel = &GPS_APP_Data.Vel;
+    OS_time_t          StartTime;
+    OS_time_t          EndTime;
+    uint32             Usec;
+    double             Dt;
+    double             SinLat;
+    double             W;
+    double             RadN;
+    double             RadM;
+    double             DLon;
+    double             E, N, U;
+    double             Alpha;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    Usec = GPS_APP_DeltaUsec(Vel->PrevTime, Sample->AcquiredTime);
+
+    if (Vel->PrevValid && Usec > 0 && Usec <= GPS_APP_VEL_MAX_GAP_MS * 1000)
+    {
+        Dt     = Usec / 1.0e6;
+        SinLat = sin(Vel->PrevLat * GPS_APP_VEL_DEG2RAD);
+        W      = 1.0 - GPS_APP_GEO_E2 * SinLat * SinLat;
+        RadN   = GPS_APP_GEO_A / sqrt(W);
+        RadM   = RadN * (1.0 - GPS_APP_GEO_E2) / W;
+
+        DLon = Sample->longitude - Vel->PrevLon;
+        if (DLon > 180.0)
+        {
+            DLon -= 360.0;
+        }
+        else if (DLon < -180.0)
+        {
+            DLon += 360.0;
+        }
+
+        E = DLon * GPS_APP_VEL_DEG2RAD * (RadN + Vel->PrevAlt) * cos(Vel->PrevLat * GPS_APP_VEL_DEG2RAD) / Dt;
+        N = (Sample->latitude - Vel->PrevLat) * GPS_APP_VEL_DEG2RAD * (RadM + Vel->PrevAlt) / Dt;
+        U = (Sample->altitude - Vel->PrevAlt) / Dt;
+
+        if (Vel->Valid)
+        {
+            Alpha = Dt / (GPS_APP_VEL_TAU_S + Dt);
+            Vel->VelE += Alpha * (E - Vel->VelE);
+            Vel->VelN += Alpha * (N - Vel->VelN);
+            Vel->VelU += Alpha * (U - Vel->VelU);
+        }
+        else
+        {
+            Vel->VelE  = E;
+            Vel->VelN  = N;
+            Vel->VelU  = U;
+            Vel->Valid = true;
+        }
+
+        Vel->Source = GPS_APP_VEL_SOURCE_DIFF;
+        GPS_APP_Vel_Outputs(Vel);
+    }
+    else if (Vel->PrevValid && Usec > 0)
+    {
+        Vel->Valid       = false;
+        Vel->Source      = GPS_APP_VEL_SOURCE_NONE;
+        Vel->GroundSpeed = 0.0f;
+        Vel->VertRate    = 0.0f;
+        Vel->VertRateCms = 0;
+    }
+
+    /*
+    ** A fix with no time step (the same sample published twice) is not a
+    ** new position, keep the previous one
+    */
+    if (!Vel->PrevValid || Usec > 0)
+    {
+        Vel->PrevLat   = Sample->latitude;
+        Vel->PrevLon   = Sample->longitude;
+        Vel->PrevAlt   = Sample->altitude;
+        Vel->PrevTime  = Sample->AcquiredTime;
+        Vel->PrevValid = true;
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+    Vel->Us = GPS_APP_DeltaUsec(StartTime, EndTime);
+    if (Vel->Us > Vel->MaxUs)
+    {
+        Vel->MaxUs = Vel->Us;
+    }
+}
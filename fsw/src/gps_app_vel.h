@@ -0,0 +1,73 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Velocity stage for the GPS App
+ *
+ * Derives ground speed, course over ground and vertical rate for each
+ * committed fix. The uC protocol only carries position, so the velocity
+ * comes from the difference to the previous fix over a local flat-earth
+ * frame (WGS-84 meridian and prime vertical radii), smoothed with a time
+ * constant so a variable fix rate gives the same response. Source records
+ * where the velocity came from, so a receiver velocity solution can be
+ * used directly if the protocol grows one.
+ */
+
+#ifndef GPS_APP_VEL_H
+#define GPS_APP_VEL_H
+
+#include "cfe.h"
+#include "gps_app_msg.h"
+#include "gps_app_sample.h"
+
+typedef struct
+{
+    bool      PrevValid;
+    double    PrevLat;
+    double    PrevLon;
+    double    PrevAlt;
+    OS_time_t PrevTime;
+
+    /*
+    ** Smoothed ENU velocity, m/s
+    */
+    bool   Valid;
+    double VelE;
+    double VelN;
+    double VelU;
+
+    /*
+    ** Outputs
+    */
+    uint8  Source;       /* GPS_APP_VEL_SOURCE_... */
+    float  GroundSpeed;  /* m/s */
+    float  CourseDeg;    /* 0-360 from true north, held at low speed */
+    float  VertRate;     /* m/s, up positive */
+    uint16 CourseCdeg;
+    int16  VertRateCms;
+
+    uint32 Us;           /* Cost of the stage per fix, last and worst */
+    uint32 MaxUs;
+} GPS_APP_VelData_t;
+
+void GPS_APP_Vel_Init(void);
+void GPS_APP_Vel_Update(const GPS_APP_Sample_t *Sample);
+
+#endif /* GPS_APP_VEL_H */
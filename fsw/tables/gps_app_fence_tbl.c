@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Default geofence table for the GPS App
+ */
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "gps_app_fence.h"
+
+/*
+** Example regions, unused entries are zero (GPS_APP_FENCE_UNUSED)
+*/
+GPS_APP_FenceTbl_t GPS_APP_FenceTbl = {
+    .Region = {
+        {
+            .Type      = GPS_APP_FENCE_CIRCLE,
+            .RegionId  = 1,
+            .CenterLat = 18.2101,
+            .CenterLon = -67.1411,
+            .RadiusM   = 500.0,
+        },
+        {
+            .Type        = GPS_APP_FENCE_POLYGON,
+            .RegionId    = 2,
+            .NumVertices = 4,
+            .Lat         = {18.2000, 18.2000, 18.2200, 18.2200},
+            .Lon         = {-67.1500, -67.1300, -67.1300, -67.1500},
+        },
+    },
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(GPS_APP_FenceTbl, GPS_APP.FenceTbl, GPS App Geofence Table, gps_app_fence_tbl.tbl)
@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Default output stream table for the GPS App
+ */
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "gps_app_msgids.h"
+#include "gps_app_stream.h"
+
+/*
+** A compact position on every fix for control, and everything at a tenth of
+** the fix rate for the ground. Unused entries are zero.
+*/
+GPS_APP_StreamTbl_t GPS_APP_StreamTbl = {
+    .Stream = {
+        {
+            .MsgId     = GPS_APP_STREAM_FAST_MID,
+            .Divisor   = 1,
+            .FieldMask = GPS_APP_STREAM_LAT | GPS_APP_STREAM_LON | GPS_APP_STREAM_ALT,
+            .Encoding  = GPS_APP_STREAM_COMPACT,
+        },
+        {
+            .MsgId     = GPS_APP_STREAM_SLOW_MID,
+            .Divisor   = 10,
+            .FieldMask = GPS_APP_STREAM_ALL_FIELDS,
+            .Encoding  = GPS_APP_STREAM_FULL,
+        },
+    },
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(GPS_APP_StreamTbl, GPS_APP.StreamTbl, GPS App Output Stream Table, gps_app_stream_tbl.tbl)